@@ -65,6 +65,7 @@
 #include <guunits/Coordinate.h>
 
 #include "arcs.h"
+#include "arc_geometry.h"
 
 namespace GU
 {
@@ -72,13 +73,13 @@ namespace GU
     struct Arc: public ::gu_arc
     {
 
-        Arc(): ::gu_arc {} {}
+        constexpr Arc(): ::gu_arc {} {}
 
-        Arc(::gu_coordinate coordinate): Arc(::arc_for_coordinate(coordinate)) {}
+        constexpr Arc(::gu_coordinate coordinate): Arc(forCoordinate(coordinate)) {}
 
-        Arc(::gu_arc arc): Arc(arc.segmentLength, arc.turnSteps, arc.straightSteps, arc.maxTurnSpeed, arc.maxForwardSpeed, arc.theta) {}
+        constexpr Arc(::gu_arc arc): Arc(arc.segmentLength, arc.turnSteps, arc.straightSteps, arc.maxTurnSpeed, arc.maxForwardSpeed, arc.theta) {}
 
-        Arc(
+        constexpr Arc(
             uint16_t _segmentLength,
             float _turnSteps,
             float _straightSteps,
@@ -87,23 +88,75 @@ namespace GU
             radians_f _theta
         ): ::gu_arc { _segmentLength, _turnSteps, _straightSteps, _maxTurnSpeed, _maxForwardSpeed, _theta } {}
 
+        /**
+         * Identical to arc_for_coordinate_fast but usable in constant
+         * expressions, as both evaluate the functions in arc_geometry.h.
+         */
+        static constexpr Arc forCoordinate(::gu_coordinate coordinate)
+        {
+            return fromSegment(::gu_arc_geometry_magnitude(coordinate.direction), ::gu_arc_geometry_segment_distance(::gu_arc_geometry_magnitude(coordinate.direction), ::gu_arc_geometry_magnitude(coordinate.distance)));
+        }
+
+    private:
+
+        static constexpr Arc fromSegment(unsigned int magnitude, float segmentDistance)
+        {
+            return fromDistances(magnitude, segmentDistance, ::gu_arc_geometry_return_distance(segmentDistance));
+        }
+
+        static constexpr Arc fromDistances(unsigned int magnitude, float segmentDistance, float returnDistance)
+        {
+            return fromSpeeds(magnitude, segmentDistance, returnDistance, ::gu_arc_geometry_max_forward_speed(returnDistance), ::gu_arc_geometry_max_turn_speed(magnitude));
+        }
+
+        static constexpr Arc fromSpeeds(unsigned int magnitude, float segmentDistance, float returnDistance, float maxForwardSpeed, float maxTurnSpeed)
+        {
+            return Arc(
+                static_cast<uint16_t>(returnDistance),
+                ::gu_arc_geometry_turn_steps(magnitude, maxTurnSpeed),
+                ::gu_arc_geometry_straight_steps(segmentDistance, maxForwardSpeed),
+                static_cast<int8_t>(maxTurnSpeed),
+                static_cast<int16_t>(maxForwardSpeed),
+                static_cast<radians_f>(::gu_arc_geometry_theta(magnitude))
+            );
+        }
+
     };
 
     struct ArcSpeed: public ::gu_arcspeed
     {
-        ArcSpeed(): ::gu_arcspeed {} {}
+        constexpr ArcSpeed(): ::gu_arcspeed {} {}
 
-        ArcSpeed(::gu_coordinate coordinate): ArcSpeed(::arcspeed_to_coordinate(coordinate)) {}
+        constexpr ArcSpeed(::gu_coordinate coordinate): ArcSpeed(coordinate, Arc::forCoordinate(coordinate)) {}
 
-        ArcSpeed(::gu_coordinate coordinate, ::gu_arc arc): ArcSpeed(::arcspeed_to_coordinate_on_arc(coordinate, arc)) {}
+        constexpr ArcSpeed(::gu_coordinate coordinate, ::gu_arc arc): ArcSpeed(toCoordinateOnArc(coordinate, arc)) {}
 
-        ArcSpeed(::gu_arcspeed speed): ArcSpeed(speed.turnSpeed, speed.forwardSpeed) {}
+        constexpr ArcSpeed(::gu_arcspeed speed): ArcSpeed(speed.turnSpeed, speed.forwardSpeed) {}
 
-        ArcSpeed(
+        constexpr ArcSpeed(
             int8_t _turnSpeed,
             int16_t _forwardSpeed
         ): ::gu_arcspeed { _turnSpeed, _forwardSpeed } {} 
 
+        /**
+         * Identical to arcspeed_to_coordinate_on_arc but usable in constant
+         * expressions.
+         */
+        static constexpr ArcSpeed toCoordinateOnArc(::gu_coordinate coordinate, ::gu_arc arc)
+        {
+            return fromSteps(coordinate.direction < 0, arc, ::gu_arc_geometry_finite_or_zero(arc.turnSteps), ::gu_arc_geometry_finite_or_zero(arc.straightSteps));
+        }
+
+    private:
+
+        static constexpr ArcSpeed fromSteps(bool negative, ::gu_arc arc, float turnSteps, float straightSteps)
+        {
+            return ArcSpeed(
+                ::gu_arc_geometry_turn_speed(negative, turnSteps, straightSteps, arc.maxTurnSpeed),
+                ::gu_arc_geometry_forward_speed(turnSteps, straightSteps, arc.maxForwardSpeed)
+            );
+        }
+
     };
 
 };
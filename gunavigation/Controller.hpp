@@ -0,0 +1,276 @@
+/*
+ * Controller.hpp 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef CONTROLLER_HPP
+#define CONTROLLER_HPP
+
+#include "control.h"
+
+namespace GU
+{
+
+    /**
+     * The control algorithms that a Controller may be specialised for.
+     */
+    enum ControlAlgorithm
+    {
+        Proportional,
+        ProportionalDerivative,
+        ProportionalIntegralDerivative
+    };
+
+    /**
+     * The state of a single control loop, equivalent to ::gu_control but
+     * parameterised on the scalar type.
+     */
+    template <typename Scalar>
+    struct ControlState
+    {
+
+        Scalar target;
+
+        Scalar current;
+
+        Scalar error;
+
+        Scalar lastError;
+
+        Scalar totalError;
+
+        Scalar controllerOutput;
+
+        constexpr ControlState(): target(0), current(0), error(0), lastError(0), totalError(0), controllerOutput(0) {}
+
+        constexpr ControlState(
+            Scalar _target,
+            Scalar _current,
+            Scalar _error,
+            Scalar _lastError,
+            Scalar _totalError,
+            Scalar _controllerOutput
+        ): target(_target), current(_current), error(_error), lastError(_lastError), totalError(_totalError), controllerOutput(_controllerOutput) {}
+
+        /**
+         * Equivalent to ::gu_create_control.
+         */
+        static constexpr ControlState create(Scalar _current, Scalar _target)
+        {
+            return ControlState(_target, _current, _target - _current, 0, 0, 0);
+        }
+
+        ControlState(::gu_control control): ControlState(
+            static_cast<Scalar>(control.target),
+            static_cast<Scalar>(control.current),
+            static_cast<Scalar>(control.error),
+            static_cast<Scalar>(control.lastError),
+            static_cast<Scalar>(control.totalError),
+            static_cast<Scalar>(control.controllerOutput)
+        ) {}
+
+        ::gu_control _c() const
+        {
+            const ::gu_control control = {
+                static_cast<double>(target),
+                static_cast<double>(current),
+                static_cast<double>(error),
+                static_cast<double>(lastError),
+                static_cast<double>(totalError),
+                static_cast<double>(controllerOutput)
+            };
+            return control;
+        }
+
+    };
+
+    /**
+     * The terms of the controller output for each algorithm.
+     *
+     * Each specialisation only evaluates the terms its algorithm uses so
+     * that no dispatch is performed at runtime.
+     */
+    template <ControlAlgorithm Algorithm, typename Scalar>
+    struct ControlTerms;
+
+    template <typename Scalar>
+    struct ControlTerms<Proportional, Scalar>
+    {
+        static constexpr Scalar output(Scalar proportionalGain, Scalar, Scalar, Scalar newError, Scalar, Scalar, Scalar)
+        {
+            return proportionalGain * newError;
+        }
+    };
+
+    template <typename Scalar>
+    struct ControlTerms<ProportionalDerivative, Scalar>
+    {
+        static constexpr Scalar output(Scalar proportionalGain, Scalar derivativeGain, Scalar, Scalar newError, Scalar lastError, Scalar, Scalar time)
+        {
+            return proportionalGain * newError + derivativeGain * ((newError - lastError) / time);
+        }
+    };
+
+    template <typename Scalar>
+    struct ControlTerms<ProportionalIntegralDerivative, Scalar>
+    {
+        static constexpr Scalar output(Scalar proportionalGain, Scalar derivativeGain, Scalar integralGain, Scalar newError, Scalar lastError, Scalar totalError, Scalar time)
+        {
+            return proportionalGain * newError + derivativeGain * ((newError - lastError) / time) + integralGain * totalError;
+        }
+    };
+
+    /**
+     * A control loop whose algorithm and scalar type are fixed at compile time.
+     *
+     * The gains are stored in constexpr-constructible members so a Controller
+     * may be declared constexpr, and the unused terms for the chosen algorithm
+     * are never evaluated. step() otherwise follows the same update rules as
+     * ::gu_p_control, ::gu_pd_control and ::gu_pid_control.
+     */
+    template <ControlAlgorithm Algorithm, typename Scalar = double>
+    class Controller
+    {
+
+        private:
+
+            Scalar _proportionalGain;
+
+            Scalar _derivativeGain;
+
+            Scalar _integralGain;
+
+            constexpr ControlState<Scalar> next(const ControlState<Scalar> &previous, Scalar reading, Scalar newError, Scalar totalError, Scalar time) const
+            {
+                return ControlState<Scalar>(
+                    previous.target,
+                    reading,
+                    newError,
+                    previous.error,
+                    totalError,
+                    ControlTerms<Algorithm, Scalar>::output(_proportionalGain, _derivativeGain, _integralGain, newError, previous.error, totalError, time)
+                );
+            }
+
+            constexpr ControlState<Scalar> next(const ControlState<Scalar> &previous, Scalar reading, Scalar newError, Scalar time) const
+            {
+                return next(previous, reading, newError, previous.totalError + newError * time, time);
+            }
+
+        public:
+
+            typedef Scalar scalar_type;
+
+            constexpr Controller(Scalar proportionalGain, Scalar derivativeGain = 0, Scalar integralGain = 0):
+                _proportionalGain(proportionalGain),
+                _derivativeGain(derivativeGain),
+                _integralGain(integralGain)
+            {}
+
+            Controller(::gu_controller controller): Controller(
+                static_cast<Scalar>(controller.proportionalGain),
+                static_cast<Scalar>(controller.derivativeGain),
+                static_cast<Scalar>(controller.integralGain)
+            ) {}
+
+            constexpr Scalar proportionalGain() const
+            {
+                return _proportionalGain;
+            }
+
+            constexpr Scalar derivativeGain() const
+            {
+                return _derivativeGain;
+            }
+
+            constexpr Scalar integralGain() const
+            {
+                return _integralGain;
+            }
+
+            /**
+             * Perform a single iteration of the control algorithm given a new
+             * reading and the time dt since the last iteration.
+             */
+            constexpr ControlState<Scalar> step(const ControlState<Scalar> &previous, Scalar reading, Scalar time) const
+            {
+                return next(previous, reading, previous.target - reading, time);
+            }
+
+            ::gu_controller _c() const
+            {
+                const ::gu_controller controller = {
+                    static_cast<double>(_proportionalGain),
+                    static_cast<double>(_derivativeGain),
+                    static_cast<double>(_integralGain)
+                };
+                return controller;
+            }
+
+    };
+
+    typedef Controller<Proportional> PController;
+    typedef Controller<ProportionalDerivative> PDController;
+    typedef Controller<ProportionalIntegralDerivative> PIDController;
+
+    typedef Controller<Proportional, float> PControllerf;
+    typedef Controller<ProportionalDerivative, float> PDControllerf;
+    typedef Controller<ProportionalIntegralDerivative, float> PIDControllerf;
+
+};
+
+#endif  /* CONTROLLER_HPP */
@@ -0,0 +1,441 @@
+/*
+ * KalmanFilter.hpp 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef KALMANFILTER_HPP
+#define KALMANFILTER_HPP
+
+#include <stddef.h>
+#include <math.h>
+
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+#include "tracking.h"
+
+namespace GU
+{
+
+    /**
+     * A fixed-size, stack allocated matrix.
+     *
+     * All operations run in time bounded by the dimensions and never allocate.
+     */
+    template <size_t Rows, size_t Cols, typename Scalar = double>
+    struct Matrix
+    {
+
+        Scalar data[Rows][Cols];
+
+        static Matrix zero()
+        {
+            Matrix m;
+            for (size_t i = 0; i < Rows; i++)
+                for (size_t j = 0; j < Cols; j++)
+                    m.data[i][j] = 0;
+            return m;
+        }
+
+        static Matrix identity()
+        {
+            Matrix m = zero();
+            for (size_t i = 0; i < Rows && i < Cols; i++)
+                m.data[i][i] = 1;
+            return m;
+        }
+
+        Scalar & operator()(size_t row, size_t col)
+        {
+            return data[row][col];
+        }
+
+        const Scalar & operator()(size_t row, size_t col) const
+        {
+            return data[row][col];
+        }
+
+        Matrix operator+(const Matrix &other) const
+        {
+            Matrix m;
+            for (size_t i = 0; i < Rows; i++)
+                for (size_t j = 0; j < Cols; j++)
+                    m.data[i][j] = data[i][j] + other.data[i][j];
+            return m;
+        }
+
+        Matrix operator-(const Matrix &other) const
+        {
+            Matrix m;
+            for (size_t i = 0; i < Rows; i++)
+                for (size_t j = 0; j < Cols; j++)
+                    m.data[i][j] = data[i][j] - other.data[i][j];
+            return m;
+        }
+
+        template <size_t OtherCols>
+        Matrix<Rows, OtherCols, Scalar> operator*(const Matrix<Cols, OtherCols, Scalar> &other) const
+        {
+            Matrix<Rows, OtherCols, Scalar> m;
+            for (size_t i = 0; i < Rows; i++)
+            {
+                for (size_t j = 0; j < OtherCols; j++)
+                {
+                    Scalar sum = 0;
+                    for (size_t k = 0; k < Cols; k++)
+                        sum += data[i][k] * other.data[k][j];
+                    m.data[i][j] = sum;
+                }
+            }
+            return m;
+        }
+
+        Matrix<Cols, Rows, Scalar> transpose() const
+        {
+            Matrix<Cols, Rows, Scalar> m;
+            for (size_t i = 0; i < Rows; i++)
+                for (size_t j = 0; j < Cols; j++)
+                    m.data[j][i] = data[i][j];
+            return m;
+        }
+
+    };
+
+    /**
+     * Invert a square matrix with Gauss-Jordan elimination and partial
+     * pivoting. Returns false, leaving inverse unspecified, if the matrix is
+     * singular.
+     */
+    template <size_t N, typename Scalar>
+    bool invert(Matrix<N, N, Scalar> matrix, Matrix<N, N, Scalar> &inverse)
+    {
+        inverse = Matrix<N, N, Scalar>::identity();
+        for (size_t col = 0; col < N; col++)
+        {
+            size_t pivot = col;
+            for (size_t row = col + 1; row < N; row++)
+                if (fabs(static_cast<double>(matrix(row, col))) > fabs(static_cast<double>(matrix(pivot, col))))
+                    pivot = row;
+            if (!(fabs(static_cast<double>(matrix(pivot, col))) > 0.0))
+                return false;
+            if (pivot != col)
+            {
+                for (size_t j = 0; j < N; j++)
+                {
+                    const Scalar temp = matrix(col, j);
+                    matrix(col, j) = matrix(pivot, j);
+                    matrix(pivot, j) = temp;
+                    const Scalar inverseTemp = inverse(col, j);
+                    inverse(col, j) = inverse(pivot, j);
+                    inverse(pivot, j) = inverseTemp;
+                }
+            }
+            const Scalar scale = 1 / matrix(col, col);
+            for (size_t j = 0; j < N; j++)
+            {
+                matrix(col, j) *= scale;
+                inverse(col, j) *= scale;
+            }
+            for (size_t row = 0; row < N; row++)
+            {
+                if (row == col)
+                    continue;
+                const Scalar factor = matrix(row, col);
+                for (size_t j = 0; j < N; j++)
+                {
+                    matrix(row, j) -= factor * matrix(col, j);
+                    inverse(row, j) -= factor * inverse(col, j);
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * A linear (or extended) Kalman filter with compile-time dimensions.
+     *
+     * The state, covariance and every intermediate matrix live on the stack,
+     * so predict and update run in bounded time without allocating.
+     */
+    template <size_t StateDim, size_t MeasDim, typename Scalar = double>
+    class KalmanFilter
+    {
+
+        public:
+
+            typedef Matrix<StateDim, 1, Scalar> StateVector;
+            typedef Matrix<StateDim, StateDim, Scalar> StateMatrix;
+            typedef Matrix<MeasDim, 1, Scalar> MeasurementVector;
+            typedef Matrix<MeasDim, MeasDim, Scalar> MeasurementMatrix;
+            typedef Matrix<MeasDim, StateDim, Scalar> ObservationMatrix;
+
+        private:
+
+            StateVector _state;
+
+            StateMatrix _covariance;
+
+        public:
+
+            KalmanFilter(): _state(StateVector::zero()), _covariance(StateMatrix::identity()) {}
+
+            KalmanFilter(const StateVector &state, const StateMatrix &covariance): _state(state), _covariance(covariance) {}
+
+            const StateVector & state() const
+            {
+                return _state;
+            }
+
+            const StateMatrix & covariance() const
+            {
+                return _covariance;
+            }
+
+            /**
+             * Linear prediction: x = Fx, P = FPF' + Q.
+             */
+            void predict(const StateMatrix &transition, const StateMatrix &processNoise)
+            {
+                predict(transition * _state, transition, processNoise);
+            }
+
+            /**
+             * Extended prediction where the caller has already propagated the
+             * state through the motion model and supplies its Jacobian.
+             */
+            void predict(const StateVector &predictedState, const StateMatrix &jacobian, const StateMatrix &processNoise)
+            {
+                _state = predictedState;
+                _covariance = jacobian * _covariance * jacobian.transpose() + processNoise;
+            }
+
+            /**
+             * Update with a measurement z = Hx + v where v has covariance R.
+             *
+             * Returns false, leaving the filter unchanged, if the innovation
+             * covariance is singular.
+             */
+            bool update(const MeasurementVector &measurement, const ObservationMatrix &observation, const MeasurementMatrix &noise)
+            {
+                return updateWithInnovation(measurement - observation * _state, observation, noise);
+            }
+
+            /**
+             * Update with a precomputed innovation z - h(x), allowing callers to
+             * wrap angular components or use a nonlinear observation model.
+             */
+            bool updateWithInnovation(const MeasurementVector &innovation, const ObservationMatrix &observation, const MeasurementMatrix &noise)
+            {
+                const Matrix<StateDim, MeasDim, Scalar> transposed = observation.transpose();
+                const MeasurementMatrix innovationCovariance = observation * _covariance * transposed + noise;
+                MeasurementMatrix inverse;
+                if (!invert(innovationCovariance, inverse))
+                    return false;
+                const Matrix<StateDim, MeasDim, Scalar> gain = _covariance * transposed * inverse;
+                _state = _state + gain * innovation;
+                _covariance = (StateMatrix::identity() - gain * observation) * _covariance;
+                return true;
+            }
+
+    };
+
+    /**
+     * A three state (x, y, heading) pose filter driven by odometry.
+     *
+     * Positions are in millimetres and the heading is in radians. The
+     * prediction step uses the same motion model as track(): the forward and
+     * left deltas are rotated by the original heading plus the turn delta,
+     * with resetCounter changes handled identically. Vision fixes can then be
+     * fused with updatePosition or updatePose.
+     */
+    template <typename Scalar = double>
+    class PoseFilter
+    {
+
+        public:
+
+            typedef KalmanFilter<3, 3, Scalar> Filter;
+
+        private:
+
+            Filter _filter;
+
+            gu_odometry_reading _lastReading;
+
+            /**
+             * The variance added per millimetre travelled and per radian turned.
+             */
+            Scalar _translationNoise;
+
+            Scalar _rotationNoise;
+
+            static Scalar wrap(Scalar angle)
+            {
+                const Scalar pi = static_cast<Scalar>(M_PI);
+                const Scalar twoPi = 2 * pi;
+                return angle - twoPi * static_cast<Scalar>(floor(static_cast<double>((angle + pi) / twoPi)));
+            }
+
+        public:
+
+            PoseFilter(
+                const gu_field_coordinate initialPosition,
+                const gu_odometry_reading initialReading,
+                const typename Filter::StateMatrix &initialCovariance,
+                Scalar translationNoise,
+                Scalar rotationNoise
+            ): _filter(), _lastReading(initialReading), _translationNoise(translationNoise), _rotationNoise(rotationNoise)
+            {
+                typename Filter::StateVector state;
+                state(0, 0) = static_cast<Scalar>(mm_t_to_d(initialPosition.position.x));
+                state(1, 0) = static_cast<Scalar>(mm_t_to_d(initialPosition.position.y));
+                state(2, 0) = static_cast<Scalar>(rad_d_to_d(deg_t_to_rad_d(initialPosition.heading)));
+                _filter = Filter(state, initialCovariance);
+            }
+
+            const Filter & filter() const
+            {
+                return _filter;
+            }
+
+            Scalar x() const
+            {
+                return _filter.state()(0, 0);
+            }
+
+            Scalar y() const
+            {
+                return _filter.state()(1, 0);
+            }
+
+            Scalar heading() const
+            {
+                return _filter.state()(2, 0);
+            }
+
+            gu_field_coordinate fieldCoordinate() const
+            {
+                const gu_field_coordinate coordinate = {
+                    {d_to_mm_t(static_cast<double>(x())), d_to_mm_t(static_cast<double>(y()))},
+                    rad_d_to_deg_t(d_to_rad_d(static_cast<double>(heading())))
+                };
+                return coordinate;
+            }
+
+            /**
+             * Predict the pose from a new cumulative odometry reading.
+             */
+            void predict(const gu_odometry_reading reading)
+            {
+                const bool reset = reading.resetCounter != _lastReading.resetCounter;
+                const Scalar forward = static_cast<Scalar>(mm_t_to_d(reset ? reading.forward : reading.forward - _lastReading.forward));
+                const Scalar left = static_cast<Scalar>(mm_t_to_d(reset ? reading.left : reading.left - _lastReading.left));
+                const Scalar turn = static_cast<Scalar>(rad_d_to_d(reset ? reading.turn : reading.turn - _lastReading.turn));
+                _lastReading = reading;
+                const Scalar angle = heading() + turn;
+                const Scalar sine = static_cast<Scalar>(sin(static_cast<double>(angle)));
+                const Scalar cosine = static_cast<Scalar>(cos(static_cast<double>(angle)));
+                typename Filter::StateVector predicted;
+                predicted(0, 0) = x() + forward * cosine - left * sine;
+                predicted(1, 0) = y() + forward * sine + left * cosine;
+                predicted(2, 0) = angle;
+                typename Filter::StateMatrix jacobian = Filter::StateMatrix::identity();
+                jacobian(0, 2) = -forward * sine - left * cosine;
+                jacobian(1, 2) = forward * cosine - left * sine;
+                const Scalar distance = static_cast<Scalar>(fabs(static_cast<double>(forward)) + fabs(static_cast<double>(left)));
+                typename Filter::StateMatrix noise = Filter::StateMatrix::zero();
+                noise(0, 0) = _translationNoise * distance;
+                noise(1, 1) = _translationNoise * distance;
+                noise(2, 2) = _rotationNoise * static_cast<Scalar>(fabs(static_cast<double>(turn)));
+                _filter.predict(predicted, jacobian, noise);
+            }
+
+            /**
+             * Fuse an observed position with the given variance in mm^2.
+             */
+            bool updatePosition(const gu_cartesian_coordinate position, Scalar variance)
+            {
+                typename Filter::MeasurementVector innovation;
+                innovation(0, 0) = static_cast<Scalar>(mm_t_to_d(position.x)) - x();
+                innovation(1, 0) = static_cast<Scalar>(mm_t_to_d(position.y)) - y();
+                innovation(2, 0) = 0;
+                typename Filter::ObservationMatrix observation = Filter::ObservationMatrix::identity();
+                observation(2, 2) = 0;
+                typename Filter::MeasurementMatrix noise = Filter::MeasurementMatrix::identity();
+                noise(0, 0) = variance;
+                noise(1, 1) = variance;
+                return _filter.updateWithInnovation(innovation, observation, noise);
+            }
+
+            /**
+             * Fuse an observed pose with the given measurement covariance.
+             * The heading innovation is wrapped to [-pi, pi).
+             */
+            bool updatePose(const gu_field_coordinate pose, const typename Filter::MeasurementMatrix &noise)
+            {
+                typename Filter::MeasurementVector innovation;
+                innovation(0, 0) = static_cast<Scalar>(mm_t_to_d(pose.position.x)) - x();
+                innovation(1, 0) = static_cast<Scalar>(mm_t_to_d(pose.position.y)) - y();
+                innovation(2, 0) = wrap(static_cast<Scalar>(rad_d_to_d(deg_t_to_rad_d(pose.heading))) - heading());
+                return _filter.updateWithInnovation(innovation, Filter::ObservationMatrix::identity(), noise);
+            }
+
+    };
+
+};
+
+#endif  /* KALMANFILTER_HPP */
@@ -0,0 +1,205 @@
+/*
+ * LocalisationWorkers.hpp 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef LOCALISATIONWORKERS_HPP
+#define LOCALISATIONWORKERS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "localisation.h"
+
+namespace GU
+{
+
+    /**
+     * Runs the ::gu_mcl motion update on several threads.
+     *
+     * The particles are split into one contiguous range per thread, in
+     * multiples of 16 particles so that threads rarely write to the same
+     * cache line, and the calling thread updates the first range itself.
+     * The worker threads are created once and sleep between updates so
+     * that an update does not allocate or create threads. Because each
+     * particle has its own random number generator the result is
+     * identical to ::gu_mcl_predict.
+     */
+    class LocalisationWorkers
+    {
+
+        private:
+
+            static const size_t Alignment = 16;
+
+            std::vector<std::thread> _threads;
+
+            std::mutex _mutex;
+
+            std::condition_variable _started;
+
+            std::condition_variable _finished;
+
+            uint64_t _generation;
+
+            size_t _remaining;
+
+            bool _stopping;
+
+            gu_mcl *_mcl;
+
+            gu_mcl_motion _motion;
+
+            size_t _chunk;
+
+            void predictChunk(const size_t index)
+            {
+                const size_t begin = index * _chunk;
+                const size_t end = begin + _chunk < _mcl->count ? begin + _chunk : _mcl->count;
+                gu_mcl_predict_range(_mcl, _motion, begin, end);
+            }
+
+            void work(const size_t index)
+            {
+                uint64_t generation = 0;
+                for (;;) {
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        while (!_stopping && _generation == generation) {
+                            _started.wait(lock);
+                        }
+                        if (_stopping) {
+                            return;
+                        }
+                        generation = _generation;
+                    }
+                    predictChunk(index);
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (--_remaining == 0) {
+                        _finished.notify_one();
+                    }
+                }
+            }
+
+        public:
+
+            /**
+             * Use threads threads in total, including the calling thread.
+             */
+            explicit LocalisationWorkers(const size_t threads): _threads(), _mutex(), _started(), _finished(), _generation(0), _remaining(0), _stopping(false), _mcl(nullptr), _motion(), _chunk(0)
+            {
+                for (size_t i = 1; i < threads; i++) {
+                    _threads.push_back(std::thread(&LocalisationWorkers::work, this, i));
+                }
+            }
+
+            LocalisationWorkers(const LocalisationWorkers &) = delete;
+
+            LocalisationWorkers &operator=(const LocalisationWorkers &) = delete;
+
+            ~LocalisationWorkers()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stopping = true;
+                }
+                _started.notify_all();
+                for (size_t i = 0; i < _threads.size(); i++) {
+                    _threads[i].join();
+                }
+            }
+
+            size_t threads() const
+            {
+                return _threads.size() + 1;
+            }
+
+            /**
+             * Equivalent to ::gu_mcl_predict.
+             */
+            void predict(gu_mcl &mcl, const gu_odometry_reading reading)
+            {
+                const size_t perThread = (mcl.count + threads() - 1) / threads();
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _mcl = &mcl;
+                    _motion = gu_mcl_motion_between(reading, mcl.last_reading);
+                    _chunk = (perThread + Alignment - 1) / Alignment * Alignment;
+                    _remaining = _threads.size();
+                    _generation++;
+                }
+                _started.notify_all();
+                predictChunk(0);
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    while (_remaining != 0) {
+                        _finished.wait(lock);
+                    }
+                }
+                mcl.last_reading = reading;
+            }
+
+    };
+
+};
+
+#endif  /* LOCALISATIONWORKERS_HPP */
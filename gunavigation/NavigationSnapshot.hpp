@@ -0,0 +1,240 @@
+/*
+ * NavigationSnapshot.hpp 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef NAVIGATIONSNAPSHOT_HPP
+#define NAVIGATIONSNAPSHOT_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "control.h"
+#include "tracking.h"
+#include "Seqlock.hpp"
+
+namespace GU
+{
+
+    /**
+     * Publishes a value from a single writer to many readers through two
+     * alternating Seqlock buffers.
+     *
+     * Each store() writes the buffer that readers are not directed to and
+     * then advances the version, so a reader copying the current buffer is
+     * only disturbed if the writer stores twice during the copy. Readers
+     * never write to shared memory.
+     */
+    template <typename T>
+    class SnapshotPublisher
+    {
+
+        private:
+
+            alignas(CacheLineSize) std::atomic<uint64_t> _version;
+
+            Seqlock<T> _even;
+
+            Seqlock<T> _odd;
+
+            const Seqlock<T> &buffer(const uint64_t version) const
+            {
+                return (version & 1) == 0 ? _even : _odd;
+            }
+
+        public:
+
+            explicit SnapshotPublisher(const T &initial): _version(0), _even(initial), _odd(initial) {}
+
+            SnapshotPublisher(const SnapshotPublisher &) = delete;
+
+            SnapshotPublisher &operator=(const SnapshotPublisher &) = delete;
+
+            /**
+             * Publish value. Only one thread may call store().
+             */
+            void store(const T &value)
+            {
+                const uint64_t next = _version.load(std::memory_order_relaxed) + 1;
+                ((next & 1) == 0 ? _even : _odd).store(value);
+                _version.store(next, std::memory_order_release);
+            }
+
+            /**
+             * Copy the latest value into out and return the version observed
+             * before copying. The copy is at least as new as that version.
+             */
+            uint64_t load(T &out) const
+            {
+                for (;;) {
+                    const uint64_t version = _version.load(std::memory_order_acquire);
+                    if (buffer(version).tryLoad(out)) {
+                        return version;
+                    }
+                }
+            }
+
+            T load() const
+            {
+                T value;
+                load(value);
+                return value;
+            }
+
+            /**
+             * Copy the latest value into out only if it is newer than
+             * version, updating version.
+             *
+             * Returns false, without copying, when nothing has been
+             * published since version.
+             */
+            bool refresh(T &out, uint64_t &version) const
+            {
+                if (_version.load(std::memory_order_acquire) == version) {
+                    return false;
+                }
+                version = load(out);
+                return true;
+            }
+
+            /**
+             * The number of calls to store().
+             */
+            uint64_t version() const
+            {
+                return _version.load(std::memory_order_acquire);
+            }
+
+    };
+
+    /**
+     * The navigation state shared with behaviours, logging and telemetry.
+     */
+    struct NavigationSnapshot
+    {
+
+        gu_odometry_status status;
+
+        gu_odometry_control control;
+
+    };
+
+    /**
+     * Publishes the latest odometry status and control together so that
+     * readers always see a matching pair.
+     *
+     * The publish functions may only be called from one thread. The status
+     * and control may be published separately, in which case the other half
+     * of the snapshot is the most recently published value.
+     */
+    class NavigationPublisher
+    {
+
+        private:
+
+            NavigationSnapshot _latest;
+
+            SnapshotPublisher<NavigationSnapshot> _snapshots;
+
+        public:
+
+            explicit NavigationPublisher(const NavigationSnapshot &initial): _latest(initial), _snapshots(initial) {}
+
+            void publish(const gu_odometry_status &status, const gu_odometry_control &control)
+            {
+                _latest.status = status;
+                _latest.control = control;
+                _snapshots.store(_latest);
+            }
+
+            void publish(const gu_odometry_status &status)
+            {
+                _latest.status = status;
+                _snapshots.store(_latest);
+            }
+
+            void publish(const gu_odometry_control &control)
+            {
+                _latest.control = control;
+                _snapshots.store(_latest);
+            }
+
+            NavigationSnapshot snapshot() const
+            {
+                return _snapshots.load();
+            }
+
+            /**
+             * See SnapshotPublisher::refresh.
+             */
+            bool refresh(NavigationSnapshot &out, uint64_t &version) const
+            {
+                return _snapshots.refresh(out, version);
+            }
+
+            uint64_t version() const
+            {
+                return _snapshots.version();
+            }
+
+    };
+
+};
+
+#endif  /* NAVIGATIONSNAPSHOT_HPP */
@@ -0,0 +1,157 @@
+/*
+ * OdometryTracker.hpp 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef ODOMETRYTRACKER_HPP
+#define ODOMETRYTRACKER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tracking.h"
+#include "SPSCQueue.hpp"
+#include "Seqlock.hpp"
+
+namespace GU
+{
+
+    /**
+     * Tracks a target from readings produced on another thread.
+     *
+     * The motion driver thread calls push() for each reading, the tracking
+     * thread periodically calls update() to apply every pending reading with
+     * ::track_batch, and any thread may call status() to read the latest
+     * status. None of these block each other.
+     */
+    template <size_t Capacity = 256>
+    class OdometryTracker
+    {
+
+        private:
+
+            SPSCQueue<gu_odometry_reading, Capacity> _readings;
+
+            Seqlock<gu_odometry_status> _published;
+
+            gu_odometry_status _status;
+
+            gu_odometry_reading _pending[Capacity];
+
+            gu_odometry_status _statuses[Capacity];
+
+        public:
+
+            explicit OdometryTracker(const gu_odometry_status initial): _readings(), _published(initial), _status(initial), _pending(), _statuses() {}
+
+            OdometryTracker(const OdometryTracker &) = delete;
+
+            OdometryTracker &operator=(const OdometryTracker &) = delete;
+
+            /**
+             * Queue a reading. Only the motion driver thread may call push().
+             *
+             * Returns false when Capacity readings are already pending. Since
+             * readings are cumulative the driver may simply push its next
+             * reading instead, but a reading immediately before a counter
+             * reset should be retried.
+             */
+            bool push(const gu_odometry_reading reading)
+            {
+                return _readings.push(reading);
+            }
+
+            /**
+             * Apply all pending readings and publish the resulting status.
+             * Only the tracking thread may call update().
+             *
+             * Returns the number of readings applied. Nothing is published
+             * when no readings were pending.
+             */
+            size_t update()
+            {
+                const size_t count = _readings.pop(_pending, Capacity);
+                if (count == 0) {
+                    return 0;
+                }
+                track_batch(_pending, count, _status, _statuses);
+                _status = _statuses[count - 1];
+                _published.store(_status);
+                return count;
+            }
+
+            /**
+             * The most recently published status.
+             */
+            gu_odometry_status status() const
+            {
+                return _published.load();
+            }
+
+            /**
+             * The number of times update() has published a status.
+             */
+            uint32_t version() const
+            {
+                return _published.version();
+            }
+
+    };
+
+};
+
+#endif  /* ODOMETRYTRACKER_HPP */
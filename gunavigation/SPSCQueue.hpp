@@ -0,0 +1,175 @@
+/*
+ * SPSCQueue.hpp 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include <stddef.h>
+
+#include <atomic>
+
+namespace GU
+{
+
+    /**
+     * The size of a cache line on the targets this library runs on.
+     *
+     * Indices written by different threads are aligned to this so that they
+     * never share a line.
+     */
+    static const size_t CacheLineSize = 64;
+
+    /**
+     * A wait-free, fixed capacity queue for exactly one producer thread and
+     * one consumer thread.
+     *
+     * push() may only be called by the producer and pop() only by the
+     * consumer. Each side keeps a cached copy of the other side's index so
+     * that the shared index is only read when the queue appears full or
+     * empty. Capacity must be a power of two.
+     */
+    template <typename T, size_t Capacity>
+    class SPSCQueue
+    {
+
+        static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+        private:
+
+            static const size_t Mask = Capacity - 1;
+
+            alignas(CacheLineSize) std::atomic<size_t> _head;
+
+            size_t _cachedTail;
+
+            alignas(CacheLineSize) std::atomic<size_t> _tail;
+
+            size_t _cachedHead;
+
+            alignas(CacheLineSize) T _buffer[Capacity];
+
+        public:
+
+            SPSCQueue(): _head(0), _cachedTail(0), _tail(0), _cachedHead(0), _buffer() {}
+
+            SPSCQueue(const SPSCQueue &) = delete;
+
+            SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+            /**
+             * Append value to the queue.
+             *
+             * Returns false without modifying the queue when it is full.
+             */
+            bool push(const T &value)
+            {
+                const size_t tail = _tail.load(std::memory_order_relaxed);
+                if (tail - _cachedHead == Capacity) {
+                    _cachedHead = _head.load(std::memory_order_acquire);
+                    if (tail - _cachedHead == Capacity) {
+                        return false;
+                    }
+                }
+                _buffer[tail & Mask] = value;
+                _tail.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * Remove up to max values from the front of the queue into out.
+             *
+             * Returns the number of values removed.
+             */
+            size_t pop(T *out, const size_t max)
+            {
+                const size_t head = _head.load(std::memory_order_relaxed);
+                if (_cachedTail - head < max) {
+                    _cachedTail = _tail.load(std::memory_order_acquire);
+                }
+                const size_t available = _cachedTail - head;
+                const size_t count = available < max ? available : max;
+                for (size_t i = 0; i < count; i++) {
+                    out[i] = _buffer[(head + i) & Mask];
+                }
+                _head.store(head + count, std::memory_order_release);
+                return count;
+            }
+
+            /**
+             * The number of values in the queue.
+             *
+             * This is only a snapshot when called while the other thread is
+             * pushing or popping.
+             */
+            size_t size() const
+            {
+                const size_t head = _head.load(std::memory_order_acquire);
+                return _tail.load(std::memory_order_acquire) - head;
+            }
+
+            static constexpr size_t capacity()
+            {
+                return Capacity;
+            }
+
+    };
+
+};
+
+#endif  /* SPSCQUEUE_HPP */
@@ -0,0 +1,172 @@
+/*
+ * Seqlock.hpp 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SEQLOCK_HPP
+#define SEQLOCK_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+#include <type_traits>
+
+#include "SPSCQueue.hpp"
+
+namespace GU
+{
+
+    /**
+     * A single writer, many reader sequence lock around a trivially copyable
+     * value.
+     *
+     * The writer never waits for readers. A reader retries its copy if the
+     * writer stored a new value while it was copying. The value is held as
+     * relaxed atomic words, so concurrent copies are not data races.
+     */
+    template <typename T>
+    class Seqlock
+    {
+
+        static_assert(std::is_trivially_copyable<T>::value, "Seqlock values must be trivially copyable.");
+
+        private:
+
+            static const size_t Words = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+            alignas(CacheLineSize) std::atomic<uint32_t> _sequence;
+
+            std::atomic<uint64_t> _words[Words];
+
+        public:
+
+            explicit Seqlock(const T &value): _sequence(0)
+            {
+                uint64_t words[Words] = {};
+                memcpy(words, &value, sizeof(T));
+                for (size_t i = 0; i < Words; i++) {
+                    _words[i].store(words[i], std::memory_order_relaxed);
+                }
+            }
+
+            Seqlock(const Seqlock &) = delete;
+
+            Seqlock &operator=(const Seqlock &) = delete;
+
+            /**
+             * Replace the value. Only one thread may call store().
+             */
+            void store(const T &value)
+            {
+                uint64_t words[Words] = {};
+                memcpy(words, &value, sizeof(T));
+                const uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+                _sequence.store(sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                for (size_t i = 0; i < Words; i++) {
+                    _words[i].store(words[i], std::memory_order_relaxed);
+                }
+                _sequence.store(sequence + 2, std::memory_order_release);
+            }
+
+            /**
+             * Copy the value into out, failing if a store() overlapped the
+             * copy.
+             */
+            bool tryLoad(T &out) const
+            {
+                const uint32_t before = _sequence.load(std::memory_order_acquire);
+                if ((before & 1) != 0) {
+                    return false;
+                }
+                uint64_t words[Words];
+                for (size_t i = 0; i < Words; i++) {
+                    words[i] = _words[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (_sequence.load(std::memory_order_relaxed) != before) {
+                    return false;
+                }
+                memcpy(&out, words, sizeof(T));
+                return true;
+            }
+
+            /**
+             * Copy the value, retrying until a consistent copy is made.
+             */
+            T load() const
+            {
+                T value;
+                while (!tryLoad(value)) {}
+                return value;
+            }
+
+            /**
+             * The number of completed calls to store().
+             */
+            uint32_t version() const
+            {
+                return _sequence.load(std::memory_order_acquire) >> 1;
+            }
+
+    };
+
+};
+
+#endif  /* SEQLOCK_HPP */
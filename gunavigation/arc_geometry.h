@@ -0,0 +1,281 @@
+/*
+ * arc_geometry.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef GUNAVIGATION_ARC_GEOMETRY_H
+#define GUNAVIGATION_ARC_GEOMETRY_H
+
+#include <float.h>
+#include <stdint.h>
+
+#include "arcs.h"
+
+/*
+ * The arc calculations shared by arcs.c and by GU::Arc and GU::ArcSpeed in
+ * Arcs.hpp. Each function is a single expression so that it is also a valid
+ * C++11 constexpr function, which lets arcs computed at compile time be
+ * identical to those computed by arc_for_coordinate_fast and
+ * arcspeed_to_coordinate_on_arc.
+ */
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define GU_ARC_GEOMETRY_FUNCTION static constexpr
+#define GU_ARC_GEOMETRY_CONSTANT static constexpr
+#else
+#define GU_ARC_GEOMETRY_FUNCTION static inline
+#define GU_ARC_GEOMETRY_CONSTANT static const
+#endif
+
+#define GU_ARC_FORWARD_MIN_SPEED 80.0f // mm/s
+#define GU_ARC_FORWARD_MAX_SPEED 160.0f // mm/s
+#define GU_ARC_TURN_MIN_SPEED 10.0f // degrees/s
+#define GU_ARC_TURN_MAX_SPEED 80.0f // degrees/s
+
+/*
+ * The ratio between the length of the arc and the straight line distance to
+ * the coordinate for each whole degree of direction, i.e. alpha / sin(alpha).
+ *
+ * Generated in double precision and rounded to float.
+ */
+GU_ARC_GEOMETRY_CONSTANT float gu_arc_segment_ratios[GU_ARC_TABLE_DIRECTIONS] = {
+    1.0f, 1.00005077f, 1.00020311f, 1.00045707f, 1.00081278f, 1.00127037f,
+    1.00183005f, 1.00249205f, 1.00325666f, 1.0041242f, 1.00509506f, 1.00616964f,
+    1.00734841f, 1.00863187f, 1.01002059f, 1.01151516f, 1.01311624f, 1.01482451f,
+    1.01664074f, 1.01856571f, 1.02060027f, 1.02274532f, 1.02500181f, 1.02737074f,
+    1.02985317f, 1.03245021f, 1.03516303f, 1.03799286f, 1.04094098f, 1.04400874f,
+    1.04719755f, 1.05050887f, 1.05394425f, 1.05750528f, 1.06119363f, 1.06501104f,
+    1.06895933f, 1.07304038f, 1.07725616f, 1.0816087f, 1.08610012f, 1.09073263f,
+    1.09550853f, 1.10043018f, 1.10550006f, 1.11072073f, 1.11609486f, 1.12162521f,
+    1.12731464f, 1.13316613f, 1.13918276f, 1.14536775f, 1.1517244f, 1.15825617f,
+    1.16496662f, 1.17185948f, 1.17893858f, 1.18620792f, 1.19367165f, 1.20133404f,
+    1.20919958f, 1.21727287f, 1.22555874f, 1.23406215f, 1.2427883f, 1.25174254f,
+    1.26093047f, 1.27035789f, 1.2800308f, 1.28995548f, 1.30013842f, 1.31058638f,
+    1.3213064f, 1.33230578f, 1.34359213f, 1.35517335f, 1.36705769f, 1.37925371f,
+    1.39177034f, 1.40461688f, 1.41780302f, 1.43133885f, 1.44523491f, 1.45950219f,
+    1.47415213f, 1.48919671f, 1.5046484f, 1.52052027f, 1.53682593f, 1.55357965f,
+    1.57079633f, 1.58849155f, 1.60668166f, 1.62538374f, 1.6446157f, 1.66439632f,
+    1.68474529f, 1.70568328f, 1.72723197f, 1.74941415f, 1.77225377f, 1.79577601f,
+    1.82000736f, 1.84497574f, 1.87071052f, 1.89724269f, 1.92460494f, 1.95283176f,
+    1.9819596f, 2.01202698f, 2.04307466f, 2.07514577f, 2.10828602f, 2.1425439f,
+    2.17797082f, 2.21462142f, 2.25255379f, 2.29182971f, 2.33251501f, 2.37467987f,
+    2.41839915f, 2.46375287f, 2.51082656f, 2.55971184f, 2.61050686f, 2.663317f,
+    2.71825545f, 2.77544402f, 2.8350139f, 2.89710665f, 2.96187519f, 3.02948496f,
+    3.10011526f, 3.1739607f, 3.25123286f, 3.3321622f, 3.41700019f, 3.50602174f,
+    3.59952802f, 3.69784966f, 3.80135042f, 3.91043144f, 4.02553617f, 4.14715608f,
+    4.27583733f, 4.4121886f, 4.55689028f, 4.71070532f, 4.87449215f, 5.04922007f,
+    5.23598776f, 5.43604553f, 5.65082248f, 5.88195955f, 6.13135027f, 6.4011913f,
+    6.69404559f, 7.012922f, 7.36137662f, 7.74364313f, 8.16480215f, 8.63100416f,
+    9.14976665f, 9.73037621f, 10.3844414f, 11.1266668f, 11.9759584f, 12.9570402f,
+    14.1028777f, 15.4584244f, 17.086616f, 19.0783599f, 21.5700181f, 24.7758749f,
+    29.0530713f, 35.0444629f, 44.0357621f, 59.0269673f, 89.0180765f, 179.009088f
+};
+
+/*
+ * The magnitude of value, which is unsigned so that it is defined for
+ * INT_MIN.
+ */
+GU_ARC_GEOMETRY_FUNCTION unsigned int gu_arc_geometry_magnitude(const int value)
+{
+    return value < 0 ? 0u - (unsigned int) value : (unsigned int) value;
+}
+
+/*
+ * Round to the nearest integer with halves away from zero, as roundf does,
+ * for values within the range of an int32_t. This is the float, constexpr
+ * form of gu_round_to_int32 in trigonometry.h.
+ */
+GU_ARC_GEOMETRY_FUNCTION int32_t gu_arc_geometry_round_to_int(const float value)
+{
+    return (int32_t) value + (int32_t) ((value - (float) (int32_t) value) * 2.0f);
+}
+
+/*
+ * Converts a parameter rather than a call, which keeps casts of function
+ * results out of the expressions below.
+ */
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_to_float(const int32_t value)
+{
+    return (float) value;
+}
+
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_round(const float value)
+{
+    return gu_arc_geometry_to_float(gu_arc_geometry_round_to_int(value));
+}
+
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_finite_or_zero(const float value)
+{
+    return value >= -FLT_MAX && value <= FLT_MAX ? value : 0.0f;
+}
+
+/*
+ * alpha / |sin(alpha)| for a whole degree magnitude that is not a multiple of
+ * 180. Beyond the table |sin(alpha)| repeats every 180 degrees while alpha
+ * keeps growing, so the ratio is scaled by the magnitude.
+ */
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_segment_ratio(const unsigned int magnitude)
+{
+    return magnitude < GU_ARC_TABLE_DIRECTIONS
+        ? gu_arc_segment_ratios[magnitude]
+        : gu_arc_segment_ratios[magnitude % 180] * (float) magnitude / (float) (magnitude % 180);
+}
+
+/*
+ * The segment distance, see arc_for_coordinate, with turns on the spot
+ * having no straight segment.
+ */
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_segment_distance(const unsigned int magnitude, const unsigned int distance)
+{
+    return magnitude == 0
+        ? (float) distance
+        : (magnitude % 180 == 0 ? 0.0f : (float) distance * gu_arc_geometry_segment_ratio(magnitude));
+}
+
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_return_distance(const float segmentDistance)
+{
+    return segmentDistance < (float) UINT16_MAX ? gu_arc_geometry_round(segmentDistance) : (float) UINT16_MAX;
+}
+
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_max_forward_speed(const float returnDistance)
+{
+    return returnDistance / 2.0f > GU_ARC_FORWARD_MAX_SPEED
+        ? GU_ARC_FORWARD_MAX_SPEED
+        : (returnDistance / 2.0f < GU_ARC_FORWARD_MIN_SPEED ? GU_ARC_FORWARD_MIN_SPEED : returnDistance / 2.0f);
+}
+
+/*
+ * roundf(theta / 180) * GU_ARC_TURN_MAX_SPEED clamped to
+ * [GU_ARC_TURN_MIN_SPEED, GU_ARC_TURN_MAX_SPEED] only takes the two end
+ * points.
+ */
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_max_turn_speed(const unsigned int magnitude)
+{
+    return magnitude < 90 ? GU_ARC_TURN_MIN_SPEED : GU_ARC_TURN_MAX_SPEED;
+}
+
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_turn_steps(const unsigned int magnitude, const float maxTurnSpeed)
+{
+    return (float) magnitude / maxTurnSpeed;
+}
+
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_straight_steps(const float segmentDistance, const float maxForwardSpeed)
+{
+    return segmentDistance / (maxForwardSpeed / 10.0f);
+}
+
+GU_ARC_GEOMETRY_FUNCTION float gu_arc_geometry_theta(const unsigned int magnitude)
+{
+    return (float) (2.0 * ((double) magnitude * 3.14159265358979323846 / 180.0));
+}
+
+GU_ARC_GEOMETRY_FUNCTION int16_t gu_arc_geometry_min_forward_speed(const int16_t speed, const int16_t maxForwardSpeed)
+{
+    return speed < maxForwardSpeed ? speed : maxForwardSpeed;
+}
+
+GU_ARC_GEOMETRY_FUNCTION int8_t gu_arc_geometry_min_turn_speed(const int8_t speed, const int8_t maxTurnSpeed)
+{
+    return speed < maxTurnSpeed ? speed : maxTurnSpeed;
+}
+
+GU_ARC_GEOMETRY_FUNCTION int8_t gu_arc_geometry_directed(const int negative, const int8_t speed)
+{
+    return negative ? (int8_t) -speed : speed;
+}
+
+/*
+ * The forward speed along an arc with finite steps. Turns on the spot do
+ * not move forward and straight lines move at the maximum speed.
+ */
+GU_ARC_GEOMETRY_FUNCTION int16_t gu_arc_geometry_forward_speed(const float turnSteps, const float straightSteps, const int16_t maxForwardSpeed)
+{
+    return straightSteps <= 0.0f
+        ? (int16_t) 0
+        : (turnSteps <= 0.0f
+            ? maxForwardSpeed
+            : gu_arc_geometry_min_forward_speed(
+                (int16_t) gu_arc_geometry_round_to_int(straightSteps / turnSteps >= 1.0f ? (float) maxForwardSpeed : straightSteps / turnSteps * (float) maxForwardSpeed),
+                maxForwardSpeed
+            ));
+}
+
+GU_ARC_GEOMETRY_FUNCTION int8_t gu_arc_geometry_modified_turn_speed(const float turnSpeed, const int8_t maxTurnSpeed)
+{
+    return gu_arc_geometry_min_turn_speed((int8_t) gu_arc_geometry_round_to_int(turnSpeed + turnSpeed * 0.1f), maxTurnSpeed);
+}
+
+/*
+ * The turn speed along an arc with finite steps, in the direction of the
+ * coordinate. Straight lines do not turn and turns on the spot turn at the
+ * maximum speed.
+ */
+GU_ARC_GEOMETRY_FUNCTION int8_t gu_arc_geometry_turn_speed(const int negative, const float turnSteps, const float straightSteps, const int8_t maxTurnSpeed)
+{
+    return turnSteps <= 0.0f
+        ? (int8_t) 0
+        : gu_arc_geometry_directed(
+            negative,
+            straightSteps <= 0.0f
+                ? maxTurnSpeed
+                : gu_arc_geometry_modified_turn_speed(
+                    straightSteps / turnSteps >= 1.0f ? turnSteps / straightSteps * (float) maxTurnSpeed : (float) maxTurnSpeed,
+                    maxTurnSpeed
+                )
+        );
+}
+
+#endif  /* GUNAVIGATION_ARC_GEOMETRY_H */
@@ -0,0 +1,220 @@
+/*
+ * arcs.c 
+ * gunavigation 
+ *
+ * Created by Callum McColl on 20/12/2019.
+ * Copyright © 2019 Callum McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Callum McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "arcs.h"
+#include "arc_geometry.h"
+#include "vectorisation.h"
+#include <stdlib.h>
+#include <math.h>
+
+static gu_arc make_arc(const unsigned int magnitude, const float segmentDistance)
+{
+    const float returnDistance = gu_arc_geometry_return_distance(segmentDistance);
+    const float maxForwardSpeed = gu_arc_geometry_max_forward_speed(returnDistance);
+    const float maxTurnSpeed = gu_arc_geometry_max_turn_speed(magnitude);
+    const float straightSteps = gu_arc_geometry_straight_steps(segmentDistance, maxForwardSpeed);
+    const float turnSteps = gu_arc_geometry_turn_steps(magnitude, maxTurnSpeed);
+    const radians_f theta = f_to_rad_f(gu_arc_geometry_theta(magnitude));
+    const gu_arc arc = {(uint16_t) returnDistance, turnSteps, straightSteps, (int8_t) maxTurnSpeed, (int16_t) maxForwardSpeed, theta};
+    return arc;
+}
+
+/*
+ * The arc can be defined as the following graphic:
+
+                segmentDistance
+                   _     _
+             _                 _
+       _                            _
+   _    alpha                            _
+_-----------------------------------------_
+\  beta           distance               /
+  \                                    /
+    \                                /
+      \                            /
+        \                        /
+          \                    / radius
+            \   theta        /
+              \            /
+                \        /
+                  \    /
+                    \/
+
+ * Since beta = 90 - alpha, theta = 2 * alpha and the radius is
+ * distance / (2 * |sin(alpha)|). The segment distance radius * theta
+ * therefore reduces to distance * alpha / |sin(alpha)|, which is a straight
+ * line when alpha is zero and a turn on the spot when alpha is a multiple of
+ * 180 degrees. As in the original sqrtf formulation, only the magnitude of
+ * the distance is used.
+ */
+gu_arc arc_for_coordinate(gu_coordinate coordinate)
+{
+    const unsigned int magnitude = gu_arc_geometry_magnitude(coordinate.direction);
+    const double distance = fabs((double) coordinate.distance);
+    if (magnitude == 0) {
+        return make_arc(magnitude, (float) distance);
+    }
+    if (magnitude % 180 == 0) {
+        // The arc's radius is infinite, so the robot turns on the spot
+        // without a straight segment.
+        return make_arc(magnitude, 0.0f);
+    }
+    const double alpha = rad_d_to_d(deg_d_to_rad_d(d_to_deg_d((double) magnitude)));
+    return make_arc(magnitude, (float) (distance * alpha / fabs(sin(alpha))));
+}
+
+gu_arc arc_for_coordinate_fast(gu_coordinate coordinate)
+{
+    const unsigned int magnitude = gu_arc_geometry_magnitude(coordinate.direction);
+    return make_arc(magnitude, gu_arc_geometry_segment_distance(magnitude, gu_arc_geometry_magnitude(coordinate.distance)));
+}
+
+gu_arcspeed arcspeed_to_coordinate_on_arc(gu_coordinate coordinate, gu_arc arc)
+{
+    const float turnSteps = gu_arc_geometry_finite_or_zero(arc.turnSteps);
+    const float straightSteps = gu_arc_geometry_finite_or_zero(arc.straightSteps);
+    const gu_arcspeed speed = {
+        gu_arc_geometry_turn_speed(coordinate.direction < 0, turnSteps, straightSteps, arc.maxTurnSpeed),
+        gu_arc_geometry_forward_speed(turnSteps, straightSteps, arc.maxForwardSpeed)
+    };
+    return speed;
+}
+
+gu_arcspeed arcspeed_to_coordinate(gu_coordinate coordinate)
+{
+    const gu_arc arc = arc_for_coordinate(coordinate);
+    return arcspeed_to_coordinate_on_arc(coordinate, arc);
+}
+
+gu_arcspeed arcspeed_to_coordinate_fast(gu_coordinate coordinate)
+{
+    const gu_arc arc = arc_for_coordinate_fast(coordinate);
+    return arcspeed_to_coordinate_on_arc(coordinate, arc);
+}
+
+/*
+ * Any distance beyond this moves at the maximum forward speed without
+ * turning, whatever the direction, so the batch clamps distances to it
+ * without changing the result. This keeps every segment distance well
+ * within an int32_t.
+ */
+#define GU_ARC_BATCH_MAX_DISTANCE 4096
+
+/*
+ * Stands in for zero turn or straight steps when dividing one by the other.
+ * It is below any non-zero number of steps, so a straight line still moves
+ * at the maximum forward speed and a turn on the spot still turns at the
+ * maximum turn speed, and it keeps both ratios small enough to round
+ * within an int32_t.
+ */
+#define GU_ARC_BATCH_EMPTY_STEPS 0.0625f
+
+static int min_int(const int value, const int upper)
+{
+    return value < upper ? value : upper;
+}
+
+static int clamp_int(const int value, const int lower, const int upper)
+{
+    return value < lower ? lower : (value > upper ? upper : value);
+}
+
+/*
+ * arcspeed_to_coordinate_fast for every coordinate within the table, written
+ * without branches so that the loop may be vectorised with the default
+ * floating point flags. The special cases of arcspeed_to_coordinate_on_arc
+ * fall out of the division by GU_ARC_BATCH_EMPTY_STEPS, and the only
+ * selects are between integers. Every value is clamped before it is
+ * converted to an int and rounded by gu_arc_geometry_round_to_int, so the results
+ * are identical to the scalar calculation.
+ */
+static void arcspeed_batch_kernel(const gu_coordinate * GU_RESTRICT coordinates, gu_arcspeed * GU_RESTRICT speeds, const size_t count)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        const int direction = clamp_int(coordinates[i].direction, 1 - GU_ARC_TABLE_DIRECTIONS, GU_ARC_TABLE_DIRECTIONS - 1);
+        const int magnitude = direction < 0 ? -direction : direction;
+        const int clampedDistance = clamp_int(coordinates[i].distance, -GU_ARC_BATCH_MAX_DISTANCE, GU_ARC_BATCH_MAX_DISTANCE);
+        const int distance = clampedDistance < 0 ? -clampedDistance : clampedDistance;
+        const float segmentDistance = ((float) distance) * gu_arc_segment_ratios[magnitude];
+        const int returnDistance = clamp_int(gu_arc_geometry_round_to_int(segmentDistance), 2 * (int) GU_ARC_FORWARD_MIN_SPEED, 2 * (int) GU_ARC_FORWARD_MAX_SPEED);
+        const float arcForwardSpeed = ((float) returnDistance) / 2.0f;
+        const int maxForwardSpeed = returnDistance / 2;
+        const int maxTurnSpeed = magnitude < 90 ? (int) GU_ARC_TURN_MIN_SPEED : (int) GU_ARC_TURN_MAX_SPEED;
+        const float turnSteps = ((float) magnitude) / ((float) maxTurnSpeed);
+        const float straightSteps = segmentDistance / (arcForwardSpeed / 10.0f);
+        const float ratio = straightSteps / (turnSteps + (float) (magnitude == 0) * GU_ARC_BATCH_EMPTY_STEPS);
+        const float inverseRatio = turnSteps / (straightSteps + (float) (distance == 0) * GU_ARC_BATCH_EMPTY_STEPS);
+        const float turnSpeed = inverseRatio * (float) maxTurnSpeed;
+        const int forward = min_int(gu_arc_geometry_round_to_int(ratio * (float) maxForwardSpeed), maxForwardSpeed);
+        const int turn = min_int(gu_arc_geometry_round_to_int(turnSpeed + turnSpeed * 0.1f), maxTurnSpeed);
+        speeds[i].turnSpeed = (int8_t) (direction < 0 ? -turn : turn);
+        speeds[i].forwardSpeed = (int16_t) forward;
+    }
+}
+
+void arcspeed_to_coordinate_batch(const gu_coordinate *coordinates, gu_arcspeed *speeds, const size_t count)
+{
+    size_t i;
+    arcspeed_batch_kernel(coordinates, speeds, count);
+    for (i = 0; i < count; i++) {
+        if (coordinates[i].direction <= -GU_ARC_TABLE_DIRECTIONS || coordinates[i].direction >= GU_ARC_TABLE_DIRECTIONS) {
+            speeds[i] = arcspeed_to_coordinate_fast(coordinates[i]);
+        }
+    }
+}
@@ -63,9 +63,24 @@
 extern "C"{
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 #include <guunits/Coordinate.h>
 
+/**
+ * The number of whole degree directions, starting at zero, covered by the
+ * table used by arc_for_coordinate_fast.
+ */
+#define GU_ARC_TABLE_DIRECTIONS 180
+
+/**
+ * The maximum relative error of the segment distance, and therefore of
+ * straightSteps, calculated by arc_for_coordinate_fast compared with
+ * arc_for_coordinate. The segmentLength may differ by one when the segment
+ * distance lies on a rounding boundary.
+ */
+#define GU_ARC_FAST_MAX_RELATIVE_ERROR 1.0e-6f
+
 /**
  * Return a number of parameters which are calculated
  * from a coordinate.
@@ -75,6 +90,10 @@ typedef struct gu_arc
 {
     /**
      * The length of the arc.
+     *
+     * Coordinates whose direction is a non-zero multiple of 180 degrees are
+     * reached by turning on the spot, so their length, and straightSteps,
+     * are zero.
      */
     uint16_t segmentLength;
 
@@ -121,11 +140,48 @@ typedef struct gu_arcspeed {
 /**
  * Calculate the arc_parameters to a given coordinate.
  */
-gu_arc arc_for_coordinate(gu_coordinate coordinate);
+gu_arc arc_for_coordinate(gu_coordinate coordinate) __attribute__((const));
+
+/**
+ * Calculate the arc_parameters to a given coordinate using a precomputed
+ * table of the ratio between the segment distance and the distance for each
+ * whole degree of direction.
+ *
+ * The segment distance is linear in the distance so the table only needs to
+ * be indexed by direction, and since gu_coordinate directions are whole
+ * degrees the lookup needs no interpolation. Directions beyond the table are
+ * reduced into it, as |sin(alpha)| repeats every 180 degrees.
+ *
+ * GU::Arc in Arcs.hpp evaluates the same calculation, from arc_geometry.h,
+ * at compile time.
+ */
+gu_arc arc_for_coordinate_fast(gu_coordinate coordinate) __attribute__((const));
+
+/**
+ * Calculate the speeds to follow an arc to a coordinate.
+ *
+ * The turn speed always has the sign of the coordinate's direction,
+ * including when the arc is a turn on the spot.
+ */
+gu_arcspeed arcspeed_to_coordinate_on_arc(gu_coordinate coordinate, gu_arc arc) __attribute__((const));
 
-gu_arcspeed arcspeed_to_coordinate_on_arc(gu_coordinate coordinate, gu_arc arc);
+gu_arcspeed arcspeed_to_coordinate(gu_coordinate coordinate) __attribute__((const));
 
-gu_arcspeed arcspeed_to_coordinate(gu_coordinate coordinate);
+/**
+ * Equivalent to arcspeed_to_coordinate using arc_for_coordinate_fast.
+ */
+gu_arcspeed arcspeed_to_coordinate_fast(gu_coordinate coordinate) __attribute__((const));
+
+/**
+ * Calculate arcspeed_to_coordinate_fast for count coordinates, storing the
+ * results in speeds.
+ *
+ * Coordinates within the table are evaluated by a branch free loop which
+ * the compiler may vectorise. The remainder fall back to
+ * arcspeed_to_coordinate_fast. The results are identical to
+ * arcspeed_to_coordinate_fast for every coordinate.
+ */
+void arcspeed_to_coordinate_batch(const gu_coordinate *coordinates, gu_arcspeed *speeds, const size_t count);
 
 #ifdef __cplusplus
 };
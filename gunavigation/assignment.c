@@ -0,0 +1,278 @@
+/*
+ * assignment.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "assignment.h"
+
+#include <math.h>
+
+static size_t find(size_t *parent, size_t node)
+{
+    while (parent[node] != node) {
+        parent[node] = parent[parent[node]];
+        node = parent[node];
+    }
+    return node;
+}
+
+static void join(size_t *parent, const size_t first, const size_t second)
+{
+    const size_t firstRoot = find(parent, first);
+    const size_t secondRoot = find(parent, second);
+    parent[firstRoot] = secondRoot;
+}
+
+static int64_t squared_distance(const gu_cartesian_coordinate from, const gu_cartesian_coordinate to)
+{
+    const int64_t dx = (int64_t) to.x - (int64_t) from.x;
+    const int64_t dy = (int64_t) to.y - (int64_t) from.y;
+    return dx * dx + dy * dy;
+}
+
+/**
+ * Solve the rowCount x columnCount problem in workspace->cost, where
+ * rowCount <= columnCount, leaving the row assigned to each column in
+ * workspace->match (1-indexed, 0 for none).
+ *
+ * This is the Hungarian algorithm in its shortest augmenting path form:
+ * each row is added in turn by a Dijkstra search over reduced costs, kept
+ * non-negative by row and column potentials. It omits the column
+ * reduction and augmenting row reduction phases of Jonker-Volgenant, which
+ * matter little for the small clusters solved here.
+ */
+static void shortest_augmenting_path(gu_assignment_workspace *workspace, const size_t rowCount, const size_t columnCount)
+{
+    const double *cost = workspace->cost;
+    double *u = workspace->rowPotential;
+    double *v = workspace->columnPotential;
+    double *minimum = workspace->minimum;
+    size_t *match = workspace->match;
+    size_t *way = workspace->way;
+    uint8_t *used = workspace->used;
+    size_t j;
+    for (j = 0; j <= columnCount; j++) {
+        v[j] = 0.0;
+        match[j] = 0;
+        way[j] = 0;
+    }
+    size_t i;
+    for (i = 0; i <= rowCount; i++) {
+        u[i] = 0.0;
+    }
+    for (i = 1; i <= rowCount; i++) {
+        // Grow a shortest path tree from row i until it reaches a free column.
+        match[0] = i;
+        size_t column = 0;
+        for (j = 0; j <= columnCount; j++) {
+            minimum[j] = HUGE_VAL;
+            used[j] = 0;
+        }
+        do {
+            used[column] = 1;
+            const size_t row = match[column];
+            const double *rowCost = &cost[(row - 1) * columnCount];
+            double delta = HUGE_VAL;
+            size_t next = 0;
+            for (j = 1; j <= columnCount; j++) {
+                if (used[j]) {
+                    continue;
+                }
+                const double reduced = rowCost[j - 1] - u[row] - v[j];
+                if (reduced < minimum[j]) {
+                    minimum[j] = reduced;
+                    way[j] = column;
+                }
+                if (minimum[j] < delta) {
+                    delta = minimum[j];
+                    next = j;
+                }
+            }
+            for (j = 0; j <= columnCount; j++) {
+                if (used[j]) {
+                    u[match[j]] += delta;
+                    v[j] -= delta;
+                } else {
+                    minimum[j] -= delta;
+                }
+            }
+            column = next;
+        } while (match[column] != 0);
+        // Augment along the path.
+        do {
+            const size_t previous = way[column];
+            match[column] = match[previous];
+            column = previous;
+        } while (column != 0);
+    }
+}
+
+/**
+ * Solve the cluster whose tracks are workspace->rows and whose sightings
+ * are workspace->columns.
+ */
+static size_t solve_cluster(
+    gu_assignment_workspace *workspace,
+    const gu_cartesian_coordinate *tracks,
+    const size_t trackCount,
+    const gu_cartesian_coordinate *sightings,
+    const size_t sightingCount,
+    const int64_t gateSquared,
+    const double unassignable,
+    size_t *assignments
+)
+{
+    // The solver needs no more rows than columns, so transpose when there
+    // are more tracks than sightings.
+    const bool transposed = trackCount > sightingCount;
+    const size_t rowCount = transposed ? sightingCount : trackCount;
+    const size_t columnCount = transposed ? trackCount : sightingCount;
+    size_t row;
+    size_t column;
+    for (row = 0; row < rowCount; row++) {
+        for (column = 0; column < columnCount; column++) {
+            const size_t track = workspace->rows[transposed ? column : row];
+            const size_t sighting = workspace->columns[transposed ? row : column];
+            const int64_t distance = squared_distance(tracks[track], sightings[sighting]);
+            workspace->cost[row * columnCount + column] = distance <= gateSquared ? sqrt((double) distance) : unassignable;
+        }
+    }
+    shortest_augmenting_path(workspace, rowCount, columnCount);
+    size_t assigned = 0;
+    for (column = 1; column <= columnCount; column++) {
+        row = workspace->match[column];
+        if (row == 0 || !(workspace->cost[(row - 1) * columnCount + column - 1] < unassignable)) {
+            continue;
+        }
+        const size_t track = workspace->rows[transposed ? column - 1 : row - 1];
+        const size_t sighting = workspace->columns[transposed ? row - 1 : column - 1];
+        assignments[track] = sighting;
+        assigned++;
+    }
+    return assigned;
+}
+
+size_t gu_assign_gated(
+    gu_assignment_workspace *workspace,
+    const gu_cartesian_coordinate *tracks,
+    const size_t trackCount,
+    const gu_cartesian_coordinate *sightings,
+    const size_t sightingCount,
+    const millimetres_u gate,
+    size_t *assignments
+)
+{
+    const size_t rowCount = trackCount < GU_ASSIGNMENT_MAX_TRACKS ? trackCount : GU_ASSIGNMENT_MAX_TRACKS;
+    const size_t columnCount = sightingCount < GU_ASSIGNMENT_MAX_SIGHTINGS ? sightingCount : GU_ASSIGNMENT_MAX_SIGHTINGS;
+    const int64_t gateSquared = (int64_t) gate * (int64_t) gate;
+    size_t *parent = workspace->parent;
+    size_t i;
+    size_t j;
+    for (i = 0; i < trackCount; i++) {
+        assignments[i] = GU_ASSIGNMENT_NONE;
+    }
+    // Tracks are nodes [0, rowCount) and sightings follow them.
+    const size_t nodeCount = rowCount + columnCount;
+    for (i = 0; i < nodeCount; i++) {
+        parent[i] = i;
+        workspace->head[i] = GU_ASSIGNMENT_NONE;
+    }
+    for (i = 0; i < rowCount; i++) {
+        for (j = 0; j < columnCount; j++) {
+            if (squared_distance(tracks[i], sightings[j]) <= gateSquared) {
+                join(parent, i, rowCount + j);
+            }
+        }
+    }
+    // Chain the nodes of each cluster in ascending order.
+    for (i = nodeCount; i > 0; i--) {
+        const size_t root = find(parent, i - 1);
+        workspace->next[i - 1] = workspace->head[root];
+        workspace->head[root] = i - 1;
+    }
+    size_t assigned = 0;
+    for (i = 0; i < rowCount; i++) {
+        const size_t root = find(parent, i);
+        if (workspace->head[root] != i) {
+            // Only solve each cluster from its first track.
+            continue;
+        }
+        size_t clusterTracks = 0;
+        size_t clusterSightings = 0;
+        size_t node;
+        for (node = i; node != GU_ASSIGNMENT_NONE; node = workspace->next[node]) {
+            if (node < rowCount) {
+                workspace->rows[clusterTracks++] = node;
+            } else {
+                workspace->columns[clusterSightings++] = node - rowCount;
+            }
+        }
+        if (clusterSightings == 0) {
+            continue;
+        }
+        if (clusterTracks == 1 && clusterSightings == 1) {
+            assignments[i] = workspace->columns[0];
+            assigned++;
+            continue;
+        }
+        // Larger than the sum of any assignment of gated pairs, even when
+        // the gate is zero and every gated pair costs nothing.
+        const double unassignable = ((double) gate + 1.0) * (double) (clusterTracks + clusterSightings + 1);
+        assigned += solve_cluster(workspace, tracks, clusterTracks, sightings, clusterSightings, gateSquared, unassignable, assignments);
+    }
+    return assigned;
+}
@@ -0,0 +1,167 @@
+/*
+ * assignment.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef ASSIGNMENT_H
+#define ASSIGNMENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Marks a track that was not assigned a sighting.
+ */
+#define GU_ASSIGNMENT_NONE ((size_t) -1)
+
+#ifndef GU_ASSIGNMENT_MAX_TRACKS
+#define GU_ASSIGNMENT_MAX_TRACKS 64
+#endif
+
+#ifndef GU_ASSIGNMENT_MAX_SIGHTINGS
+#define GU_ASSIGNMENT_MAX_SIGHTINGS 128
+#endif
+
+#define GU_ASSIGNMENT_MAX_NODES (GU_ASSIGNMENT_MAX_TRACKS + GU_ASSIGNMENT_MAX_SIGHTINGS)
+
+#define GU_ASSIGNMENT_MAX_SIDE (GU_ASSIGNMENT_MAX_TRACKS > GU_ASSIGNMENT_MAX_SIGHTINGS ? GU_ASSIGNMENT_MAX_TRACKS : GU_ASSIGNMENT_MAX_SIGHTINGS)
+
+/**
+ * The buffers used by gu_assign_gated, kept between frames so that
+ * assignment never allocates.
+ *
+ * The workspace is large (around 75KB with the default limits) and should
+ * be allocated statically or once on the heap.
+ */
+typedef struct gu_assignment_workspace {
+
+    /**
+     * The union-find forest over tracks followed by sightings.
+     */
+    size_t parent[GU_ASSIGNMENT_MAX_NODES];
+
+    /**
+     * The first node of each cluster, indexed by its root, and the next
+     * node in the same cluster.
+     */
+    size_t head[GU_ASSIGNMENT_MAX_NODES];
+
+    size_t next[GU_ASSIGNMENT_MAX_NODES];
+
+    size_t rows[GU_ASSIGNMENT_MAX_SIDE];
+
+    size_t columns[GU_ASSIGNMENT_MAX_SIDE];
+
+    /**
+     * The cost matrix of the sub-problem being solved, row major.
+     */
+    double cost[GU_ASSIGNMENT_MAX_TRACKS * GU_ASSIGNMENT_MAX_SIGHTINGS];
+
+    double rowPotential[GU_ASSIGNMENT_MAX_SIDE + 1];
+
+    double columnPotential[GU_ASSIGNMENT_MAX_SIDE + 1];
+
+    double minimum[GU_ASSIGNMENT_MAX_SIDE + 1];
+
+    size_t match[GU_ASSIGNMENT_MAX_SIDE + 1];
+
+    size_t way[GU_ASSIGNMENT_MAX_SIDE + 1];
+
+    uint8_t used[GU_ASSIGNMENT_MAX_SIDE + 1];
+
+} gu_assignment_workspace;
+
+/**
+ * Assign sightings to tracks, minimising the total distance between them.
+ *
+ * Only pairs no further apart than gate may be assigned. The gated pairs
+ * split the tracks and sightings into independent clusters, and each
+ * cluster is solved optimally with the shortest augmenting path form of
+ * the Hungarian algorithm, using row and column potentials. When objects
+ * are well separated most clusters hold a single pair, so the cost is
+ * close to that of gating alone. Within a
+ * cluster the number of assigned pairs is maximised first, then the total
+ * distance is minimised.
+ *
+ * assignments[i] receives the index of the sighting assigned to tracks[i],
+ * or GU_ASSIGNMENT_NONE. Tracks and sightings beyond GU_ASSIGNMENT_MAX_TRACKS
+ * and GU_ASSIGNMENT_MAX_SIGHTINGS are left unassigned. Returns the number
+ * of tracks assigned a sighting.
+ */
+size_t gu_assign_gated(
+    gu_assignment_workspace *workspace,
+    const gu_cartesian_coordinate *tracks,
+    const size_t trackCount,
+    const gu_cartesian_coordinate *sightings,
+    const size_t sightingCount,
+    const millimetres_u gate,
+    size_t *assignments
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ASSIGNMENT_H */
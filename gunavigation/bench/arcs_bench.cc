@@ -0,0 +1,87 @@
+/*
+ * arcs_bench.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "benchmark.hpp"
+#include "../gunavigation.h"
+
+#include <vector>
+
+/**
+ * A frame of candidate approach points spread around the robot.
+ */
+static std::vector<gu_coordinate> candidates()
+{
+    std::vector<gu_coordinate> coordinates;
+    for (int direction = -170; direction <= 170; direction += 5) {
+        for (int distance = 20; distance <= 400; distance += 40) {
+            const gu_coordinate coordinate = {direction, distance};
+            coordinates.push_back(coordinate);
+        }
+    }
+    return coordinates;
+}
+
+static void BM_arc_for_coordinate(GUBENCH::State &state)
+{
+    const std::vector<gu_coordinate> coordinates = candidates();
+    size_t index = 0;
+    while (state.keepRunning()) {
+        GUBENCH::doNotOptimize(arc_for_coordinate(coordinates[index]));
+        index = index + 1 == coordinates.size() ? 0 : index + 1;
+    }
+}
+BENCHMARK(BM_arc_for_coordinate);
+
+static void BM_arc_for_coordinate_fast(GUBENCH::State &state)
+{
+    const std::vector<gu_coordinate> coordinates = candidates();
+    size_t index = 0;
+    while (state.keepRunning()) {
+        GUBENCH::doNotOptimize(arc_for_coordinate_fast(coordinates[index]));
+        index = index + 1 == coordinates.size() ? 0 : index + 1;
+    }
+}
+BENCHMARK(BM_arc_for_coordinate_fast);
+
+typedef gu_arcspeed (*arcspeed_function)(gu_coordinate);
+
+static void frame(GUBENCH::State &state, arcspeed_function function)
+{
+    const std::vector<gu_coordinate> coordinates = candidates();
+    std::vector<gu_arcspeed> speeds(coordinates.size());
+    state.setItemsPerIteration(static_cast<double>(coordinates.size()));
+    while (state.keepRunning()) {
+        for (size_t i = 0; i < coordinates.size(); i++) {
+            speeds[i] = function(coordinates[i]);
+        }
+        GUBENCH::clobberMemory();
+    }
+}
+
+static void BM_arcspeed_to_coordinate(GUBENCH::State &state)
+{
+    frame(state, arcspeed_to_coordinate);
+}
+BENCHMARK(BM_arcspeed_to_coordinate);
+
+static void BM_arcspeed_to_coordinate_fast(GUBENCH::State &state)
+{
+    frame(state, arcspeed_to_coordinate_fast);
+}
+BENCHMARK(BM_arcspeed_to_coordinate_fast);
+
+static void BM_arcspeed_to_coordinate_batch(GUBENCH::State &state)
+{
+    const std::vector<gu_coordinate> coordinates = candidates();
+    std::vector<gu_arcspeed> speeds(coordinates.size());
+    state.setItemsPerIteration(static_cast<double>(coordinates.size()));
+    while (state.keepRunning()) {
+        arcspeed_to_coordinate_batch(coordinates.data(), speeds.data(), coordinates.size());
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_arcspeed_to_coordinate_batch);
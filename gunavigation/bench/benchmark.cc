@@ -0,0 +1,248 @@
+/*
+ * benchmark.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*
+ * Every allocation made while a benchmark runs is counted. operator new is
+ * replaced everywhere; on glibc malloc and friends are also interposed so
+ * that allocations made by the C library under test are included.
+ */
+static std::atomic<unsigned long long> allocations(0);
+
+#if defined(__GLIBC__)
+extern "C" {
+    void *__libc_malloc(size_t);
+    void *__libc_calloc(size_t, size_t);
+    void *__libc_realloc(void *, size_t);
+    void __libc_free(void *);
+
+    void *malloc(size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t count, size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_calloc(count, size);
+    }
+
+    void *realloc(void *pointer, size_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_realloc(pointer, size);
+    }
+
+    void free(void *pointer)
+    {
+        __libc_free(pointer);
+    }
+}
+
+void *operator new(size_t size)
+{
+    void *pointer = malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+#else
+void *operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void *pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+#endif
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+/**
+ * A timestamp counter. On x86 this is the TSC, which counts at a constant
+ * reference rate rather than the current core clock; elsewhere no counter is
+ * available and cycles are not reported.
+ */
+static bool hasCycleCounter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+static unsigned long long cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+namespace GUBENCH {
+
+    Sample sample()
+    {
+        const Sample value = {
+            static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()),
+            cycles(),
+            allocations.load()
+        };
+        return value;
+    }
+
+    struct Benchmark {
+        const char *name;
+        BenchmarkFunction function;
+    };
+
+    struct Result {
+        std::string name;
+        size_t iterations;
+        double nsPerOp;
+        double cyclesPerOp;
+        double allocationsPerOp;
+        double itemsPerMs;
+    };
+
+    static std::vector<Benchmark> & benchmarks()
+    {
+        static std::vector<Benchmark> registered;
+        return registered;
+    }
+
+    int registerBenchmark(const char *name, BenchmarkFunction function)
+    {
+        const Benchmark benchmark = {name, function};
+        benchmarks().push_back(benchmark);
+        return 0;
+    }
+
+    /**
+     * Run a benchmark, doubling the iterations until a single run takes at
+     * least minTime seconds.
+     */
+    static Result run(const Benchmark &benchmark, const double minTime)
+    {
+        size_t iterations = 1;
+        for (;;) {
+            State state(iterations);
+            benchmark.function(state);
+            const Sample start = state.start();
+            const Sample end = state.end();
+            const double ns = static_cast<double>(end.nanoseconds - start.nanoseconds);
+            if (ns >= minTime * 1.0e9 || iterations >= (static_cast<size_t>(1) << 40)) {
+                const double count = static_cast<double>(iterations);
+                const Result result = {
+                    benchmark.name,
+                    iterations,
+                    ns / count,
+                    hasCycleCounter() ? static_cast<double>(end.cycles - start.cycles) / count : -1.0,
+                    static_cast<double>(end.allocations - start.allocations) / count,
+                    state.itemsPerIteration() * count / (ns / 1.0e6)
+                };
+                return result;
+            }
+            iterations *= 2;
+        }
+    }
+
+    static bool writeJSON(const char *path, const std::vector<Result> &results)
+    {
+        FILE *file = fopen(path, "w");
+        if (file == nullptr) {
+            return false;
+        }
+        fprintf(file, "{\n  \"benchmarks\": [\n");
+        for (size_t i = 0; i < results.size(); i++) {
+            const Result &result = results[i];
+            fprintf(file, "    {\n");
+            fprintf(file, "      \"name\": \"%s\",\n", result.name.c_str());
+            fprintf(file, "      \"iterations\": %zu,\n", result.iterations);
+            fprintf(file, "      \"ns_per_op\": %.3f,\n", result.nsPerOp);
+            if (hasCycleCounter()) {
+                fprintf(file, "      \"cycles_per_op\": %.3f,\n", result.cyclesPerOp);
+            } else {
+                fprintf(file, "      \"cycles_per_op\": null,\n");
+            }
+            fprintf(file, "      \"allocations_per_op\": %.3f,\n", result.allocationsPerOp);
+            fprintf(file, "      \"items_per_ms\": %.3f\n", result.itemsPerMs);
+            fprintf(file, "    }%s\n", i + 1 < results.size() ? "," : "");
+        }
+        fprintf(file, "  ]\n}\n");
+        return fclose(file) == 0;
+    }
+
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--filter=<substring>] [--min-time=<seconds>] [--json=<file>]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *filter = "";
+    const char *json = nullptr;
+    double minTime = 0.2;
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--filter=", 9) == 0) {
+            filter = argv[i] + 9;
+        } else if (strncmp(argv[i], "--min-time=", 11) == 0) {
+            minTime = atof(argv[i] + 11);
+        } else if (strncmp(argv[i], "--json=", 7) == 0) {
+            json = argv[i] + 7;
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    std::vector<GUBENCH::Result> results;
+    printf("%-44s %14s %12s %12s %10s %14s\n", "Benchmark", "Iterations", "ns/op", "cycles/op", "allocs/op", "items/ms");
+    for (size_t i = 0; i < GUBENCH::benchmarks().size(); i++) {
+        const GUBENCH::Benchmark &benchmark = GUBENCH::benchmarks()[i];
+        if (strstr(benchmark.name, filter) == nullptr) {
+            continue;
+        }
+        const GUBENCH::Result result = GUBENCH::run(benchmark, minTime);
+        results.push_back(result);
+        printf("%-44s %14zu %12.2f %12.2f %10.2f %14.1f\n", result.name.c_str(), result.iterations, result.nsPerOp, result.cyclesPerOp, result.allocationsPerOp, result.itemsPerMs);
+    }
+    if (json != nullptr && !GUBENCH::writeJSON(json, results)) {
+        fprintf(stderr, "Unable to write %s\n", json);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/*
+ * benchmark.hpp
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace GUBENCH {
+
+    /**
+     * The clock, cycle counter and allocation count at a point in time.
+     */
+    struct Sample {
+        long long nanoseconds;
+        unsigned long long cycles;
+        unsigned long long allocations;
+    };
+
+    Sample sample();
+
+    /**
+     * The state passed to each benchmark, used in the same way as a google
+     * benchmark State:
+     *
+     *     static void BM_example(GUBENCH::State &state) {
+     *         while (state.keepRunning()) {
+     *             GUBENCH::doNotOptimize(example());
+     *         }
+     *     }
+     *     BENCHMARK(BM_example);
+     */
+    class State {
+
+        size_t _iterations;
+
+        size_t _remaining;
+
+        double _itemsPerIteration;
+
+        bool _started;
+
+        Sample _start;
+
+        Sample _end;
+
+        public:
+
+        explicit State(size_t iterations): _iterations(iterations), _remaining(iterations), _itemsPerIteration(1.0), _started(false), _start(), _end() {}
+
+        size_t iterations() const { return _iterations; }
+
+        /**
+         * The number of items, e.g. readings or candidates, that each
+         * iteration processes. Used to report items per millisecond.
+         */
+        void setItemsPerIteration(double items) { _itemsPerIteration = items; }
+
+        double itemsPerIteration() const { return _itemsPerIteration; }
+
+        /**
+         * The measurements taken when the loop started and finished, so that
+         * any setup performed by the benchmark is excluded.
+         */
+        Sample start() const { return _start; }
+
+        Sample end() const { return _end; }
+
+        /**
+         * Returns true until the benchmark has run for the requested number
+         * of iterations.
+         */
+        bool keepRunning()
+        {
+            if (!_started) {
+                _started = true;
+                _start = sample();
+            }
+            if (_remaining == 0) {
+                _end = sample();
+                return false;
+            }
+            _remaining--;
+            return true;
+        }
+
+    };
+
+    typedef void (*BenchmarkFunction)(State &);
+
+    /**
+     * Adds a benchmark to the list run by the bench binary. Use the BENCHMARK
+     * macro rather than calling this directly.
+     */
+    int registerBenchmark(const char *name, BenchmarkFunction function);
+
+    /**
+     * Prevent the compiler from discarding a value that is otherwise unused.
+     */
+    template <typename T>
+    inline void doNotOptimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * Prevent the compiler from assuming memory is unchanged between
+     * iterations.
+     */
+    inline void clobberMemory()
+    {
+        asm volatile("" : : : "memory");
+    }
+
+}
+
+#define GUBENCH_CONCAT_(a, b) a##b
+#define GUBENCH_CONCAT(a, b) GUBENCH_CONCAT_(a, b)
+
+#define BENCHMARK(function) \
+    static const int GUBENCH_CONCAT(function, _registered) __attribute__((unused)) = GUBENCH::registerBenchmark(#function, function)
+
+#endif /* !BENCHMARK_HPP */
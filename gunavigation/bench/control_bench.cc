@@ -0,0 +1,134 @@
+/*
+ * control_bench.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "benchmark.hpp"
+#include "../gunavigation.h"
+
+#include <vector>
+
+typedef gu_control (*control_function)(const gu_control, const gu_controller, const double, const double);
+
+typedef gu_control_f (*control_f_function)(const gu_control_f, const gu_controller_f, const float, const float);
+
+typedef gu_control_q16 (*control_q16_function)(const gu_control_q16, const gu_controller_q16, const gu_q16, const gu_q16);
+
+/*
+ * Each control benchmark steps a controller towards a target, feeding its
+ * output back as the next reading and restarting periodically so that the
+ * values stay bounded.
+ */
+static void control(GUBENCH::State &state, control_function function)
+{
+    const gu_controller controller = {0.5, 0.1, 0.1};
+    gu_control value = gu_create_control(0.0, 6.0);
+    int step = 0;
+    while (state.keepRunning()) {
+        value = function(value, controller, value.current + value.controllerOutput, 0.5);
+        if (++step == 256) {
+            step = 0;
+            value = gu_create_control(0.0, 6.0);
+        }
+        GUBENCH::doNotOptimize(value);
+    }
+}
+
+static void control_f(GUBENCH::State &state, control_f_function function)
+{
+    const gu_controller_f controller = {0.5f, 0.1f, 0.1f};
+    gu_control_f value = gu_create_control_f(0.0f, 6.0f);
+    int step = 0;
+    while (state.keepRunning()) {
+        value = function(value, controller, value.current + value.controllerOutput, 0.5f);
+        if (++step == 256) {
+            step = 0;
+            value = gu_create_control_f(0.0f, 6.0f);
+        }
+        GUBENCH::doNotOptimize(value);
+    }
+}
+
+static void control_q16(GUBENCH::State &state, control_q16_function function)
+{
+    const gu_controller_q16 controller = {d_to_q16(0.5), d_to_q16(0.1), d_to_q16(0.1)};
+    gu_control_q16 value = gu_create_control_q16(i_to_q16(0), i_to_q16(6));
+    int step = 0;
+    while (state.keepRunning()) {
+        value = function(value, controller, q16_add(value.current, value.controllerOutput), d_to_q16(0.5));
+        if (++step == 256) {
+            step = 0;
+            value = gu_create_control_q16(i_to_q16(0), i_to_q16(6));
+        }
+        GUBENCH::doNotOptimize(value);
+    }
+}
+
+#define CONTROL_BENCHMARK(name, runner) \
+    static void BM_##name(GUBENCH::State &state) \
+    { \
+        runner(state, name); \
+    } \
+    BENCHMARK(BM_##name)
+
+CONTROL_BENCHMARK(gu_p_control, control);
+CONTROL_BENCHMARK(gu_pd_control, control);
+CONTROL_BENCHMARK(gu_pid_control, control);
+CONTROL_BENCHMARK(gu_p_control_rel, control);
+CONTROL_BENCHMARK(gu_pd_control_rel, control);
+CONTROL_BENCHMARK(gu_pid_control_rel, control);
+CONTROL_BENCHMARK(gu_p_control_f, control_f);
+CONTROL_BENCHMARK(gu_pd_control_f, control_f);
+CONTROL_BENCHMARK(gu_pid_control_f, control_f);
+CONTROL_BENCHMARK(gu_p_control_q16, control_q16);
+CONTROL_BENCHMARK(gu_pd_control_q16, control_q16);
+CONTROL_BENCHMARK(gu_pid_control_q16, control_q16);
+
+typedef void (*control_batch_function)(const gu_control_batch, const gu_controller_batch, const double *, const double *, const size_t);
+
+static void control_batch(GUBENCH::State &state, control_batch_function function)
+{
+    const size_t count = 256;
+    std::vector<double> target(count, 6.0), current(count, 0.0), error(count, 6.0), lastError(count, 6.0), totalError(count, 0.0), output(count, 0.0);
+    std::vector<double> proportional(count, 0.5), derivative(count, 0.1), integral(count, 0.1);
+    std::vector<double> readings(count), times(count, 0.5);
+    for (size_t i = 0; i < count; i++) {
+        readings[i] = static_cast<double>(i) / static_cast<double>(count);
+    }
+    const gu_control_batch values = {target.data(), current.data(), error.data(), lastError.data(), totalError.data(), output.data()};
+    const gu_controller_batch controllers = {proportional.data(), derivative.data(), integral.data()};
+    state.setItemsPerIteration(static_cast<double>(count));
+    while (state.keepRunning()) {
+        function(values, controllers, readings.data(), times.data(), count);
+        GUBENCH::clobberMemory();
+    }
+}
+
+CONTROL_BENCHMARK(gu_p_control_batch, control_batch);
+CONTROL_BENCHMARK(gu_pd_control_batch, control_batch);
+CONTROL_BENCHMARK(gu_pid_control_batch, control_batch);
+
+static void BM_position_to_odometry_control(GUBENCH::State &state)
+{
+    const gu_controller controller = {0.5, 0.1, 0.1};
+    gu_relative_coordinate target = {0.0, 1500};
+    while (state.keepRunning()) {
+        target.direction = target.direction > 170.0 ? -170.0 : target.direction + 1.0;
+        GUBENCH::doNotOptimize(position_to_odometry_control(target, controller, controller, controller));
+    }
+}
+BENCHMARK(BM_position_to_odometry_control);
+
+static void BM_position_to_odometry_control_with_heading(GUBENCH::State &state)
+{
+    const gu_controller controller = {0.5, 0.1, 0.1};
+    const gu_field_coordinate position = {{-1000, 500}, 45};
+    gu_relative_coordinate target = {0.0, 1500};
+    while (state.keepRunning()) {
+        target.direction = target.direction > 170.0 ? -170.0 : target.direction + 1.0;
+        GUBENCH::doNotOptimize(position_to_odometry_control_with_heading(position, target, 90, controller, controller, controller));
+    }
+}
+BENCHMARK(BM_position_to_odometry_control_with_heading);
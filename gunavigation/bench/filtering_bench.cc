@@ -0,0 +1,77 @@
+/*
+ * filtering_bench.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "benchmark.hpp"
+#include "../gunavigation.h"
+#include "../KalmanFilter.hpp"
+
+#include <vector>
+
+static void BM_kalman_filter(GUBENCH::State &state)
+{
+    gu_kalman_object object = {0.0, 1.0};
+    const gu_kalman_object change = {1.0, 0.5};
+    double reading = 0.0;
+    while (state.keepRunning()) {
+        reading = reading > 1000.0 ? 0.0 : reading + 1.1;
+        const gu_kalman_object sensor = {reading, 2.0};
+        object = kalman_filter(object, change, sensor);
+        GUBENCH::doNotOptimize(object);
+    }
+}
+BENCHMARK(BM_kalman_filter);
+
+static void BM_gu_kalman_filter_update(GUBENCH::State &state)
+{
+    const gu_kalman_object initial = {0.0, 1.0};
+    gu_kalman_filter filter = gu_kalman_filter_create(initial, 0.5, 2.0);
+    double reading = 0.0;
+    while (state.keepRunning()) {
+        reading = reading > 1000.0 ? 0.0 : reading + 1.1;
+        filter = gu_kalman_filter_update(filter, 1.0, reading);
+        GUBENCH::doNotOptimize(filter);
+    }
+}
+BENCHMARK(BM_gu_kalman_filter_update);
+
+static void BM_kalman_filter_bank(GUBENCH::State &state)
+{
+    const size_t count = 256;
+    std::vector<double> observable(count, 0.0), variance(count, 1.0);
+    std::vector<double> change(count, 1.0), changeVariance(count, 0.5);
+    std::vector<double> sensor(count), sensorVariance(count, 2.0);
+    for (size_t i = 0; i < count; i++) {
+        sensor[i] = static_cast<double>(i);
+    }
+    const gu_kalman_bank objects = {observable.data(), variance.data()};
+    const gu_kalman_bank expectedChanges = {change.data(), changeVariance.data()};
+    const gu_kalman_bank sensorReadings = {sensor.data(), sensorVariance.data()};
+    state.setItemsPerIteration(static_cast<double>(count));
+    while (state.keepRunning()) {
+        kalman_filter_bank(objects, expectedChanges, sensorReadings, NULL, count);
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_kalman_filter_bank);
+
+static void BM_PoseFilter(GUBENCH::State &state)
+{
+    const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+    const gu_field_coordinate initial = {{0, 0}, 0};
+    GU::PoseFilter<double> filter(initial, initialReading, GU::Matrix<3, 3>::identity(), 0.01, 0.001);
+    millimetres_t forward = 0;
+    double turn = 0.0;
+    while (state.keepRunning()) {
+        forward += 10;
+        turn += 0.01;
+        const gu_odometry_reading reading = {forward, 0, turn, 0};
+        filter.predict(reading);
+        const gu_cartesian_coordinate fix = {static_cast<millimetres_t>(filter.x()), static_cast<millimetres_t>(filter.y())};
+        GUBENCH::doNotOptimize(filter.updatePosition(fix, 100.0));
+    }
+}
+BENCHMARK(BM_PoseFilter);
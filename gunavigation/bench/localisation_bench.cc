@@ -0,0 +1,111 @@
+/*
+ * localisation_bench.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "benchmark.hpp"
+#include "../gunavigation.h"
+#include "../LocalisationWorkers.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+static const size_t particleCount = GU_MCL_MAX_PARTICLES;
+
+static std::unique_ptr<gu_mcl> filter()
+{
+    std::unique_ptr<gu_mcl> mcl(new gu_mcl);
+    const gu_field_coordinate pose = {{0, 0}, 0};
+    const gu_odometry_reading reading = {0, 0, 0.0, 0};
+    const gu_mcl_noise noise = {0.05, 0.05, 0.05, 0.0001};
+    gu_mcl_init(mcl.get(), particleCount, pose, 500.0, 0.5, reading, noise, 1);
+    return mcl;
+}
+
+static gu_odometry_reading next(gu_odometry_reading reading)
+{
+    reading.forward += 10;
+    reading.left += 1;
+    reading.turn += 0.01;
+    reading.resetCounter = reading.forward > 100000 ? static_cast<uint8_t>(reading.resetCounter + 1) : reading.resetCounter;
+    return reading;
+}
+
+/**
+ * The per-particle loop that gu_mcl replaces: a struct copy and a
+ * calculate_difference call per particle with noise from the standard
+ * library.
+ */
+static void BM_mcl_predict_reference(GUBENCH::State &state)
+{
+    std::vector<gu_precise_odometry_status> particles(particleCount);
+    std::mt19937 generator(1);
+    std::normal_distribution<double> distribution(0.0, 1.0);
+    gu_odometry_reading reading = {0, 0, 0.0, 0};
+    state.setItemsPerIteration(static_cast<double>(particleCount));
+    while (state.keepRunning()) {
+        const gu_odometry_reading current = next(reading);
+        const gu_mcl_motion motion = gu_mcl_motion_between(current, reading);
+        for (size_t i = 0; i < particleCount; i++) {
+            gu_precise_odometry_status particle = particles[i];
+            const double turn = motion.turn + 0.05 * fabs(motion.turn) * distribution(generator);
+            const gu_cartesian_coordinate difference = calculate_difference(
+                motion.forward + 0.05 * fabs(motion.forward) * distribution(generator),
+                motion.left + 0.05 * fabs(motion.left) * distribution(generator),
+                turn,
+                rad_d_to_d(particle.heading)
+            );
+            particle.x = mm_d_to_d(particle.x) + difference.x;
+            particle.y = mm_d_to_d(particle.y) + difference.y;
+            particle.heading = d_to_rad_d(rad_d_to_d(particle.heading) + turn);
+            particles[i] = particle;
+        }
+        reading = current;
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_mcl_predict_reference);
+
+static void BM_mcl_predict(GUBENCH::State &state)
+{
+    std::unique_ptr<gu_mcl> mcl = filter();
+    gu_odometry_reading reading = mcl->last_reading;
+    state.setItemsPerIteration(static_cast<double>(particleCount));
+    while (state.keepRunning()) {
+        reading = next(reading);
+        gu_mcl_predict(mcl.get(), reading);
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_mcl_predict);
+
+static void BM_mcl_predict_4_threads(GUBENCH::State &state)
+{
+    std::unique_ptr<gu_mcl> mcl = filter();
+    GU::LocalisationWorkers workers(4);
+    gu_odometry_reading reading = mcl->last_reading;
+    state.setItemsPerIteration(static_cast<double>(particleCount));
+    while (state.keepRunning()) {
+        reading = next(reading);
+        workers.predict(*mcl, reading);
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_mcl_predict_4_threads);
+
+static void BM_mcl_weight_and_resample(GUBENCH::State &state)
+{
+    std::unique_ptr<gu_mcl> mcl = filter();
+    const gu_cartesian_coordinate landmark = {3000, 0};
+    const gu_relative_coordinate sighting = {0.0, 3000};
+    state.setItemsPerIteration(static_cast<double>(particleCount));
+    while (state.keepRunning()) {
+        gu_mcl_weight_landmark(mcl.get(), landmark, sighting, 200.0);
+        gu_mcl_resample(mcl.get());
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_mcl_weight_and_resample);
@@ -0,0 +1,177 @@
+/*
+ * sightings_bench.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "benchmark.hpp"
+#include "../gunavigation.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+static const size_t objectCount = 128;
+
+static const millimetres_u gate = 300;
+
+/**
+ * A frame of sightings spread over a 9m x 6m field, with a track slightly
+ * offset from each sighting.
+ */
+static void frame(std::vector<gu_sighting> &sightings, std::vector<gu_cartesian_coordinate> &tracks)
+{
+    sightings.resize(objectCount);
+    tracks.resize(objectCount);
+    for (size_t i = 0; i < objectCount; i++) {
+        const gu_cartesian_coordinate position = {static_cast<millimetres_t>((i * 7919) % 9000) - 4500, static_cast<millimetres_t>((i * 104729) % 6000) - 3000};
+        sightings[i].location = cartesian_coord_to_rr_coord(position);
+        sightings[i].frameNumber = 1;
+        const gu_cartesian_coordinate track = {position.x + 40, position.y - 30};
+        tracks[i] = track;
+    }
+}
+
+/**
+ * The brute force association that the sighting store replaces.
+ */
+static void BM_associate_brute_force(GUBENCH::State &state)
+{
+    std::vector<gu_sighting> sightings;
+    std::vector<gu_cartesian_coordinate> tracks;
+    frame(sightings, tracks);
+    std::vector<gu_cartesian_coordinate> positions(objectCount);
+    std::vector<bool> claimed(objectCount);
+    std::vector<size_t> assignments(objectCount);
+    state.setItemsPerIteration(static_cast<double>(objectCount));
+    while (state.keepRunning()) {
+        for (size_t i = 0; i < objectCount; i++) {
+            positions[i] = rr_coord_to_cartesian_coord(sightings[i].location);
+            claimed[i] = false;
+        }
+        for (size_t t = 0; t < objectCount; t++) {
+            int64_t best = static_cast<int64_t>(gate) * static_cast<int64_t>(gate);
+            size_t bestIndex = GU_SIGHTING_STORE_NONE;
+            for (size_t i = 0; i < objectCount; i++) {
+                const int64_t dx = positions[i].x - tracks[t].x;
+                const int64_t dy = positions[i].y - tracks[t].y;
+                if (!claimed[i] && dx * dx + dy * dy <= best) {
+                    best = dx * dx + dy * dy;
+                    bestIndex = i;
+                }
+            }
+            assignments[t] = bestIndex;
+            if (bestIndex != GU_SIGHTING_STORE_NONE) {
+                claimed[bestIndex] = true;
+            }
+        }
+        GUBENCH::doNotOptimize(assignments.data());
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_associate_brute_force);
+
+static void BM_associate_sighting_store(GUBENCH::State &state)
+{
+    std::vector<gu_sighting> sightings;
+    std::vector<gu_cartesian_coordinate> tracks;
+    frame(sightings, tracks);
+    std::vector<gu_sighting_store_entry> entries(objectCount);
+    std::vector<gu_sighting_store_bucket> buckets(256);
+    std::vector<size_t> assignments(objectCount);
+    gu_sighting_store store;
+    gu_sighting_store_init(&store, entries.data(), entries.size(), buckets.data(), buckets.size(), static_cast<millimetres_t>(gate));
+    state.setItemsPerIteration(static_cast<double>(objectCount));
+    while (state.keepRunning()) {
+        gu_sighting_store_clear(&store);
+        for (size_t i = 0; i < objectCount; i++) {
+            gu_sighting_store_insert(&store, sightings[i]);
+        }
+        gu_sighting_store_associate(&store, tracks.data(), tracks.size(), gate, assignments.data());
+        GUBENCH::doNotOptimize(assignments.data());
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_associate_sighting_store);
+
+/**
+ * A frame of the multi-object tracker following 64 objects while the robot
+ * drives forward.
+ */
+static void object_tracker_update(GUBENCH::State &state, const bool optimalAssignment)
+{
+    std::vector<gu_sighting> sightings;
+    std::vector<gu_cartesian_coordinate> tracks;
+    frame(sightings, tracks);
+    sightings.resize(64);
+    const gu_object_tracker_parameters parameters = {100.0, 400.0, gate, 10, optimalAssignment};
+    static gu_object_tracker tracker;
+    gu_object_tracker_init(&tracker, parameters);
+    gu_field_coordinate position = {{0, 0}, 0};
+    uint64_t frameNumber = 0;
+    state.setItemsPerIteration(static_cast<double>(sightings.size()));
+    while (state.keepRunning()) {
+        const gu_field_coordinate oldPosition = position;
+        position.position.x = (position.position.x + 1) % 100;
+        frameNumber++;
+        gu_object_tracker_update(&tracker, oldPosition, position, sightings.data(), sightings.size(), frameNumber);
+        GUBENCH::clobberMemory();
+    }
+}
+
+static void BM_object_tracker_update(GUBENCH::State &state)
+{
+    object_tracker_update(state, false);
+}
+BENCHMARK(BM_object_tracker_update);
+
+static void BM_object_tracker_update_optimal(GUBENCH::State &state)
+{
+    object_tracker_update(state, true);
+}
+BENCHMARK(BM_object_tracker_update_optimal);
+
+/**
+ * Assign count sightings to count tracks arranged in pairs of crossing
+ * objects, so every cluster needs the solver.
+ */
+static void assign(GUBENCH::State &state, const size_t count, const millimetres_u assignmentGate)
+{
+    std::vector<gu_cartesian_coordinate> tracks(count);
+    std::vector<gu_cartesian_coordinate> sightings(count);
+    for (size_t i = 0; i < count; i++) {
+        const millimetres_t column = static_cast<millimetres_t>(i / 2) % 8;
+        const millimetres_t row = static_cast<millimetres_t>(i / 16);
+        const millimetres_t side = (i & 1) == 0 ? -1 : 1;
+        const gu_cartesian_coordinate track = {column * 1000 + side * 60, row * 1000};
+        const gu_cartesian_coordinate sighting = {column * 1000 - side * 40, row * 1000 + 10};
+        tracks[i] = track;
+        sightings[(i * 7) % count] = sighting;
+    }
+    std::vector<size_t> assignments(count);
+    static gu_assignment_workspace workspace;
+    state.setItemsPerIteration(static_cast<double>(count));
+    while (state.keepRunning()) {
+        GUBENCH::doNotOptimize(gu_assign_gated(&workspace, tracks.data(), count, sightings.data(), count, assignmentGate, assignments.data()));
+        GUBENCH::clobberMemory();
+    }
+}
+
+#define ASSIGNMENT_BENCHMARK(count) \
+    static void BM_assign_gated_##count(GUBENCH::State &state) \
+    { \
+        assign(state, count, gate); \
+    } \
+    BENCHMARK(BM_assign_gated_##count); \
+    static void BM_assign_ungated_##count(GUBENCH::State &state) \
+    { \
+        assign(state, count, 100000); \
+    } \
+    BENCHMARK(BM_assign_ungated_##count)
+
+ASSIGNMENT_BENCHMARK(4);
+ASSIGNMENT_BENCHMARK(8);
+ASSIGNMENT_BENCHMARK(16);
+ASSIGNMENT_BENCHMARK(32);
+ASSIGNMENT_BENCHMARK(64);
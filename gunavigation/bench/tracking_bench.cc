@@ -0,0 +1,161 @@
+/*
+ * tracking_bench.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "benchmark.hpp"
+#include "../gunavigation.h"
+#include "../OdometryTracker.hpp"
+
+#include <cmath>
+#include <vector>
+
+/**
+ * The original four-call implementation of calculate_difference, kept so
+ * that the current implementations can be compared against it.
+ */
+static gu_cartesian_coordinate calculate_difference_reference(double forward, double left, double turn, double originalHeading)
+{
+    const double halfPi = rad_d_to_d(deg_d_to_rad_d(d_to_deg_d(90.0)));
+    const millimetres_t x = d_to_mm_t(forward * cos(turn + originalHeading) + left * cos(turn + halfPi + originalHeading));
+    const millimetres_t y = d_to_mm_t(forward * sin(turn + originalHeading) + left * sin(turn + halfPi + originalHeading));
+    const gu_cartesian_coordinate differentialCoordinate = {x, y};
+    return differentialCoordinate;
+}
+
+typedef gu_cartesian_coordinate (*difference_function)(double, double, double, double);
+
+static void difference(GUBENCH::State &state, difference_function function)
+{
+    double turn = 0.0;
+    while (state.keepRunning()) {
+        turn = turn > 7.0 ? 0.0 : turn + 0.01;
+        GUBENCH::doNotOptimize(function(300.0, 40.0, turn, 0.5));
+    }
+}
+
+static void BM_calculate_difference_reference(GUBENCH::State &state)
+{
+    difference(state, calculate_difference_reference);
+}
+BENCHMARK(BM_calculate_difference_reference);
+
+static void BM_calculate_difference(GUBENCH::State &state)
+{
+    difference(state, calculate_difference);
+}
+BENCHMARK(BM_calculate_difference);
+
+static void BM_calculate_difference_fast(GUBENCH::State &state)
+{
+    difference(state, calculate_difference_fast);
+}
+BENCHMARK(BM_calculate_difference_fast);
+
+/**
+ * A repeating sequence of cumulative readings with a counter reset every
+ * 64 readings.
+ */
+static std::vector<gu_odometry_reading> readings(const size_t count)
+{
+    std::vector<gu_odometry_reading> values(count);
+    millimetres_t forward = 0;
+    millimetres_t left = 0;
+    double turn = 0.0;
+    uint8_t resetCounter = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (i % 64 == 63) {
+            resetCounter++;
+            forward = 0;
+            left = 0;
+            turn = 0.0;
+        }
+        forward += 12;
+        left += static_cast<millimetres_t>(static_cast<int>(i % 5) - 2);
+        turn += 0.01;
+        const gu_odometry_reading reading = {forward, left, turn, resetCounter};
+        values[i] = reading;
+    }
+    return values;
+}
+
+static gu_odometry_status initialStatus()
+{
+    const gu_odometry_reading initialReading = {0, 0, 0.0, 255};
+    const gu_relative_coordinate target = {35.0, 2000};
+    return create_status(initialReading, target);
+}
+
+static void BM_track(GUBENCH::State &state)
+{
+    const std::vector<gu_odometry_reading> values = readings(1024);
+    gu_odometry_status status = initialStatus();
+    size_t index = 0;
+    while (state.keepRunning()) {
+        status = track(values[index], status);
+        index = (index + 1) & 1023;
+        GUBENCH::doNotOptimize(status);
+    }
+}
+BENCHMARK(BM_track);
+
+static void BM_track_batch(GUBENCH::State &state)
+{
+    const std::vector<gu_odometry_reading> values = readings(1024);
+    std::vector<gu_odometry_status> out(values.size());
+    const gu_odometry_status initial = initialStatus();
+    state.setItemsPerIteration(static_cast<double>(values.size()));
+    while (state.keepRunning()) {
+        track_batch(values.data(), values.size(), initial, out.data());
+        GUBENCH::clobberMemory();
+    }
+}
+BENCHMARK(BM_track_batch);
+
+static void BM_track_cartesian(GUBENCH::State &state)
+{
+    const std::vector<gu_odometry_reading> values = readings(1024);
+    gu_cartesian_odometry_status status = create_cartesian_status(initialStatus());
+    size_t index = 0;
+    while (state.keepRunning()) {
+        status = track_cartesian(values[index], status);
+        index = (index + 1) & 1023;
+        GUBENCH::doNotOptimize(status);
+    }
+}
+BENCHMARK(BM_track_cartesian);
+
+static void BM_track_precise(GUBENCH::State &state)
+{
+    const std::vector<gu_odometry_reading> values = readings(1024);
+    gu_precise_odometry_status status = create_precise_status(initialStatus());
+    size_t index = 0;
+    while (state.keepRunning()) {
+        status = track_precise(values[index], status);
+        index = (index + 1) & 1023;
+        GUBENCH::doNotOptimize(status);
+    }
+}
+BENCHMARK(BM_track_precise);
+
+/**
+ * Queue 64 readings and apply them with a single update, as the tracking
+ * thread would after the driver produced them.
+ */
+static void BM_odometry_tracker(GUBENCH::State &state)
+{
+    const std::vector<gu_odometry_reading> values = readings(1024);
+    static GU::OdometryTracker<64> tracker(initialStatus());
+    size_t index = 0;
+    state.setItemsPerIteration(64);
+    while (state.keepRunning()) {
+        for (size_t i = 0; i < 64; i++) {
+            tracker.push(values[index + i]);
+        }
+        GUBENCH::doNotOptimize(tracker.update());
+        index = (index + 64) & 1023;
+    }
+}
+BENCHMARK(BM_odometry_tracker);
@@ -58,6 +58,7 @@
 
 #include "control.h"
 #include "math.h"
+#include "vectorisation.h"
 
 typedef enum gu_control_algorithm {
     ControlProportional,
@@ -125,6 +126,167 @@ gu_control gu_pid_control(const gu_control value, const gu_controller controller
     return makeReading(value, controller, reading, time, ControlProportionalIntegralDerivative);
 }
 
+/*
+ * The batch kernels take every array as a separate non-overlapping parameter
+ * so that the compiler can vectorise the loops without runtime alias checks.
+ */
+static void makeProportionalReadings(
+    double * GU_RESTRICT target,
+    double * GU_RESTRICT current,
+    double * GU_RESTRICT error,
+    double * GU_RESTRICT lastError,
+    double * GU_RESTRICT totalError,
+    double * GU_RESTRICT controllerOutput,
+    const double * GU_RESTRICT proportionalGain,
+    const double * GU_RESTRICT readings,
+    const double * GU_RESTRICT times,
+    const size_t count
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++)
+    {
+        const double newError = target[i] - readings[i];
+        const double integralTerm = totalError[i] + newError * times[i];
+        controllerOutput[i] = gu_proportional(proportionalGain[i], newError);
+        current[i] = readings[i];
+        lastError[i] = error[i];
+        error[i] = newError;
+        totalError[i] = integralTerm;
+    }
+}
+
+static void makeProportionalDerivativeReadings(
+    double * GU_RESTRICT target,
+    double * GU_RESTRICT current,
+    double * GU_RESTRICT error,
+    double * GU_RESTRICT lastError,
+    double * GU_RESTRICT totalError,
+    double * GU_RESTRICT controllerOutput,
+    const double * GU_RESTRICT proportionalGain,
+    const double * GU_RESTRICT derivativeGain,
+    const double * GU_RESTRICT readings,
+    const double * GU_RESTRICT times,
+    const size_t count
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++)
+    {
+        const double newError = target[i] - readings[i];
+        const double derivativeTerm = (newError - error[i]) / times[i];
+        const double integralTerm = totalError[i] + newError * times[i];
+        controllerOutput[i] = gu_proportional_derivative(proportionalGain[i], newError, derivativeTerm, derivativeGain[i]);
+        current[i] = readings[i];
+        lastError[i] = error[i];
+        error[i] = newError;
+        totalError[i] = integralTerm;
+    }
+}
+
+static void makeProportionalIntegralDerivativeReadings(
+    double * GU_RESTRICT target,
+    double * GU_RESTRICT current,
+    double * GU_RESTRICT error,
+    double * GU_RESTRICT lastError,
+    double * GU_RESTRICT totalError,
+    double * GU_RESTRICT controllerOutput,
+    const double * GU_RESTRICT proportionalGain,
+    const double * GU_RESTRICT derivativeGain,
+    const double * GU_RESTRICT integralGain,
+    const double * GU_RESTRICT readings,
+    const double * GU_RESTRICT times,
+    const size_t count
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++)
+    {
+        const double newError = target[i] - readings[i];
+        const double derivativeTerm = (newError - error[i]) / times[i];
+        const double integralTerm = totalError[i] + newError * times[i];
+        controllerOutput[i] = gu_proportional_integral_derivative(
+            proportionalGain[i],
+            newError,
+            derivativeTerm,
+            derivativeGain[i],
+            integralTerm,
+            integralGain[i]
+        );
+        current[i] = readings[i];
+        lastError[i] = error[i];
+        error[i] = newError;
+        totalError[i] = integralTerm;
+    }
+}
+
+static void makeReadings(const gu_control_batch values, const gu_controller_batch controllers, const double *readings, const double *times, const size_t count, const gu_control_algorithm algorithm)
+{
+    // The algorithm is dispatched once for the whole batch so that each loop body is branch free.
+    switch (algorithm)
+    {
+        case ControlProportional:
+            makeProportionalReadings(
+                values.target, values.current, values.error, values.lastError, values.totalError, values.controllerOutput,
+                controllers.proportionalGain,
+                readings, times, count
+            );
+            break;
+        case ControlProportionalDerivative:
+            makeProportionalDerivativeReadings(
+                values.target, values.current, values.error, values.lastError, values.totalError, values.controllerOutput,
+                controllers.proportionalGain, controllers.derivativeGain,
+                readings, times, count
+            );
+            break;
+        case ControlProportionalIntegralDerivative:
+            makeProportionalIntegralDerivativeReadings(
+                values.target, values.current, values.error, values.lastError, values.totalError, values.controllerOutput,
+                controllers.proportionalGain, controllers.derivativeGain, controllers.integralGain,
+                readings, times, count
+            );
+            break;
+    }
+}
+
+void gu_p_control_batch(const gu_control_batch values, const gu_controller_batch controllers, const double *readings, const double *times, const size_t count)
+{
+    makeReadings(values, controllers, readings, times, count, ControlProportional);
+}
+
+void gu_pd_control_batch(const gu_control_batch values, const gu_controller_batch controllers, const double *readings, const double *times, const size_t count)
+{
+    makeReadings(values, controllers, readings, times, count, ControlProportionalDerivative);
+}
+
+void gu_pid_control_batch(const gu_control_batch values, const gu_controller_batch controllers, const double *readings, const double *times, const size_t count)
+{
+    makeReadings(values, controllers, readings, times, count, ControlProportionalIntegralDerivative);
+}
+
+void gu_control_batch_set(const gu_control_batch values, const size_t index, const gu_control value)
+{
+    values.target[index] = value.target;
+    values.current[index] = value.current;
+    values.error[index] = value.error;
+    values.lastError[index] = value.lastError;
+    values.totalError[index] = value.totalError;
+    values.controllerOutput[index] = value.controllerOutput;
+}
+
+gu_control gu_control_batch_get(const gu_control_batch values, const size_t index)
+{
+    const gu_control value = {
+        values.target[index],
+        values.current[index],
+        values.error[index],
+        values.lastError[index],
+        values.totalError[index],
+        values.controllerOutput[index]
+    };
+    return value;
+}
+
 gu_control gu_create_control(const double current, const double target)
 {
     gu_control control = {
@@ -59,6 +59,7 @@
 #ifndef CONTROL_H
 #define CONTROL_H
 
+#include <stddef.h>
 #include <gucoordinates/gucoordinates.h>
 
 #ifdef __cplusplus
@@ -131,6 +132,42 @@ typedef struct gu_odometry_control {
 
 } gu_odometry_control;
 
+/**
+ * A structure-of-arrays view over many gu_control values.
+ *
+ * Element i of every array holds the corresponding field of the i'th
+ * controller. The arrays are owned by the caller and must all contain at
+ * least as many elements as the count passed to the batch functions.
+ */
+typedef struct gu_control_batch {
+
+    double *target;
+
+    double *current;
+
+    double *error;
+
+    double *lastError;
+
+    double *totalError;
+
+    double *controllerOutput;
+
+} gu_control_batch;
+
+/**
+ * A structure-of-arrays view over many gu_controller gains.
+ */
+typedef struct gu_controller_batch {
+
+    const double *proportionalGain;
+
+    const double *derivativeGain;
+
+    const double *integralGain;
+
+} gu_controller_batch;
+
 gu_control gu_create_control(const double current, const double target) __attribute__((const));
 
 /**
@@ -148,6 +185,24 @@ gu_control gu_p_control_rel(const gu_control value, const gu_controller controll
 gu_control gu_pd_control_rel(const gu_control value, const gu_controller controller, const double reading, const double time) __attribute__((const));
 gu_control gu_pid_control_rel(const gu_control value, const gu_controller controller, const double reading, const double time) __attribute__((const));
 
+/**
+ * Perform a single iteration of a control algorithm on `count` controllers at once.
+ *
+ * Each controller i is updated in place exactly as if
+ * gu_*_control(value[i], controller[i], readings[i], times[i]) had been called,
+ * producing bit-identical results. The state is laid out as a structure of arrays
+ * so that the loop can be vectorised by the compiler. None of the arrays may overlap.
+ */
+void gu_p_control_batch(const gu_control_batch values, const gu_controller_batch controllers, const double *readings, const double *times, const size_t count);
+void gu_pd_control_batch(const gu_control_batch values, const gu_controller_batch controllers, const double *readings, const double *times, const size_t count);
+void gu_pid_control_batch(const gu_control_batch values, const gu_controller_batch controllers, const double *readings, const double *times, const size_t count);
+
+/**
+ * Copy a gu_control into/out of element `index` of a gu_control_batch.
+ */
+void gu_control_batch_set(const gu_control_batch values, const size_t index, const gu_control value);
+gu_control gu_control_batch_get(const gu_control_batch values, const size_t index) __attribute__((pure));
+
 /**
  * Operator on gu_control for lhs - rhs.
  *
@@ -0,0 +1,139 @@
+/*
+ * control_f.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "control_f.h"
+
+typedef enum gu_control_algorithm_f {
+    ControlProportionalF,
+    ControlProportionalDerivativeF,
+    ControlProportionalIntegralDerivativeF
+} gu_control_algorithm_f;
+
+static gu_control_f makeReadingF(const gu_control_f previous, const gu_controller_f controller, const float reading, const float time, const gu_control_algorithm_f algorithm)
+{
+    const float newError = previous.target - reading;
+    const float derivativeTerm = (newError - previous.error) / time;
+    const float integralTerm = previous.totalError + newError * time;
+    float controllerOutput = 0.0f;
+    switch (algorithm)
+    {
+        case ControlProportionalF: controllerOutput = gu_proportional_f(controller.proportionalGain, newError);
+            break;
+        case ControlProportionalDerivativeF: controllerOutput = gu_proportional_derivative_f(controller.proportionalGain, newError, derivativeTerm, controller.derivativeGain);
+            break;
+        case ControlProportionalIntegralDerivativeF:
+            controllerOutput = gu_proportional_integral_derivative_f(controller.proportionalGain, newError, derivativeTerm, controller.derivativeGain, integralTerm, controller.integralGain);
+            break;
+    }
+    gu_control_f newValue = {
+        previous.target,
+        reading,
+        newError,
+        previous.error,
+        integralTerm,
+        controllerOutput
+    };
+    return newValue;
+}
+
+float gu_proportional_f(const float gain, const float error)
+{
+    return gain * error;
+}
+
+float gu_proportional_derivative_f(const float gain, const float error, const float errorGradient, const float gradientGain)
+{
+    const float p = gu_proportional_f(gain, error);
+    const float d = gradientGain * errorGradient;
+    return p + d;
+}
+
+float gu_proportional_integral_derivative_f(const float gain, const float error, const float errorGradient, const float gradientGain, const float errorTotal, const float integralGain)
+{
+    const float pd = gu_proportional_derivative_f(gain, error, errorGradient, gradientGain);
+    return pd + integralGain * errorTotal;
+}
+
+gu_control_f gu_p_control_f(const gu_control_f value, const gu_controller_f controller, const float reading, const float time)
+{
+    return makeReadingF(value, controller, reading, time, ControlProportionalF);
+}
+
+gu_control_f gu_pd_control_f(const gu_control_f value, const gu_controller_f controller, const float reading, const float time)
+{
+    return makeReadingF(value, controller, reading, time, ControlProportionalDerivativeF);
+}
+
+gu_control_f gu_pid_control_f(const gu_control_f value, const gu_controller_f controller, const float reading, const float time)
+{
+    return makeReadingF(value, controller, reading, time, ControlProportionalIntegralDerivativeF);
+}
+
+gu_control_f gu_create_control_f(const float current, const float target)
+{
+    gu_control_f control = {
+        target,
+        current,
+        target - current,
+        0.0f,
+        0.0f,
+        0.0f
+    };
+    return control;
+}
@@ -0,0 +1,148 @@
+/*
+ * control_f.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef CONTROL_F_H
+#define CONTROL_F_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The single precision equivalent of gu_control for targets that only
+ * provide a single precision FPU.
+ */
+typedef struct gu_control_f {
+    
+    /**
+     * The target we are heading towards.
+     */
+    float target;
+
+    /**
+     * The current value.
+     */
+    float current;
+
+    /**
+     * The error between the target and the current value.
+     */
+    float error;
+    
+    /**
+     * The error before the current iteration of the control algorithm.
+     */
+    float lastError;
+
+    /**
+     * The total error of all iterations of the control algorithm.
+     */
+    float totalError;
+
+    float controllerOutput;
+
+} gu_control_f;
+
+/**
+ * The single precision equivalent of gu_controller.
+ */
+typedef struct gu_controller_f {
+    
+    /**
+     * The proportional gain Kp.
+     */
+    float proportionalGain;
+
+    /**
+     * The derivative gain Kd.
+     */
+    float derivativeGain;
+
+    /**
+     * The integral gain Ki.
+     */
+    float integralGain;
+
+} gu_controller_f;
+
+gu_control_f gu_create_control_f(const float current, const float target) __attribute__((const));
+
+/**
+ * Single precision versions of gu_p_control, gu_pd_control and gu_pid_control.
+ */
+gu_control_f gu_p_control_f(const gu_control_f value, const gu_controller_f controller, const float reading, const float time) __attribute__((const));
+gu_control_f gu_pd_control_f(const gu_control_f value, const gu_controller_f controller, const float reading, const float time) __attribute__((const));
+gu_control_f gu_pid_control_f(const gu_control_f value, const gu_controller_f controller, const float reading, const float time) __attribute__((const));
+
+float gu_proportional_f(const float gain, const float error) __attribute__((const));
+float gu_proportional_derivative_f(const float gain, const float error, const float errorGradient, const float gradientGain) __attribute__((const));
+float gu_proportional_integral_derivative_f(
+    const float gain,
+    const float error,
+    const float errorGradient,
+    const float gradientGain,
+    const float errorTotal,
+    const float integralGain
+) __attribute__((const));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* CONTROL_F_H */
@@ -0,0 +1,218 @@
+/*
+ * control_q16.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "control_q16.h"
+
+typedef enum gu_control_algorithm_q16 {
+    ControlProportionalQ16,
+    ControlProportionalDerivativeQ16,
+    ControlProportionalIntegralDerivativeQ16
+} gu_control_algorithm_q16;
+
+static gu_q16 saturate(const int64_t value)
+{
+    if (value > (int64_t) GU_Q16_MAX) {
+        return GU_Q16_MAX;
+    }
+    if (value < (int64_t) GU_Q16_MIN) {
+        return GU_Q16_MIN;
+    }
+    return (gu_q16) value;
+}
+
+gu_q16 i_to_q16(const int32_t value)
+{
+    return saturate((int64_t) value * (int64_t) GU_Q16_ONE);
+}
+
+gu_q16 d_to_q16(const double value)
+{
+    const double scaled = value * (double) GU_Q16_ONE;
+    if (scaled >= (double) GU_Q16_MAX) {
+        return GU_Q16_MAX;
+    }
+    if (scaled <= (double) GU_Q16_MIN) {
+        return GU_Q16_MIN;
+    }
+    return (gu_q16) (scaled < 0.0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+gu_q16 f_to_q16(const float value)
+{
+    return d_to_q16((double) value);
+}
+
+double q16_to_d(const gu_q16 value)
+{
+    return (double) value / (double) GU_Q16_ONE;
+}
+
+float q16_to_f(const gu_q16 value)
+{
+    return (float) value / (float) GU_Q16_ONE;
+}
+
+gu_q16 q16_add(const gu_q16 lhs, const gu_q16 rhs)
+{
+    return saturate((int64_t) lhs + (int64_t) rhs);
+}
+
+gu_q16 q16_sub(const gu_q16 lhs, const gu_q16 rhs)
+{
+    return saturate((int64_t) lhs - (int64_t) rhs);
+}
+
+gu_q16 q16_mul(const gu_q16 lhs, const gu_q16 rhs)
+{
+    const int64_t product = (int64_t) lhs * (int64_t) rhs;
+    const int64_t half = (int64_t) GU_Q16_ONE / 2;
+    const int64_t rounded = product < 0 ? -((-product + half) / (int64_t) GU_Q16_ONE) : (product + half) / (int64_t) GU_Q16_ONE;
+    return saturate(rounded);
+}
+
+gu_q16 q16_div(const gu_q16 lhs, const gu_q16 rhs)
+{
+    if (rhs == 0) {
+        return lhs < 0 ? GU_Q16_MIN : GU_Q16_MAX;
+    }
+    const int64_t numerator = (int64_t) lhs * (int64_t) GU_Q16_ONE;
+    const int64_t denominator = (int64_t) rhs;
+    const int64_t half = (denominator < 0 ? -denominator : denominator) / 2;
+    const int64_t rounded = (numerator + (numerator < 0 ? -half : half)) / denominator;
+    return saturate(rounded);
+}
+
+static gu_control_q16 makeReadingQ16(const gu_control_q16 previous, const gu_controller_q16 controller, const gu_q16 reading, const gu_q16 time, const gu_control_algorithm_q16 algorithm)
+{
+    const gu_q16 newError = q16_sub(previous.target, reading);
+    gu_q16 controllerOutput = 0;
+    const gu_q16 integralTerm = q16_add(previous.totalError, q16_mul(newError, time));
+    switch (algorithm)
+    {
+        case ControlProportionalQ16: controllerOutput = gu_proportional_q16(controller.proportionalGain, newError);
+            break;
+        case ControlProportionalDerivativeQ16:
+        {
+            const gu_q16 derivativeTerm = q16_div(q16_sub(newError, previous.error), time);
+            controllerOutput = gu_proportional_derivative_q16(controller.proportionalGain, newError, derivativeTerm, controller.derivativeGain);
+            break;
+        }
+        case ControlProportionalIntegralDerivativeQ16:
+        {
+            const gu_q16 derivativeTerm = q16_div(q16_sub(newError, previous.error), time);
+            controllerOutput = gu_proportional_integral_derivative_q16(controller.proportionalGain, newError, derivativeTerm, controller.derivativeGain, integralTerm, controller.integralGain);
+            break;
+        }
+    }
+    gu_control_q16 newValue = {
+        previous.target,
+        reading,
+        newError,
+        previous.error,
+        integralTerm,
+        controllerOutput
+    };
+    return newValue;
+}
+
+gu_q16 gu_proportional_q16(const gu_q16 gain, const gu_q16 error)
+{
+    return q16_mul(gain, error);
+}
+
+gu_q16 gu_proportional_derivative_q16(const gu_q16 gain, const gu_q16 error, const gu_q16 errorGradient, const gu_q16 gradientGain)
+{
+    const gu_q16 p = gu_proportional_q16(gain, error);
+    const gu_q16 d = q16_mul(gradientGain, errorGradient);
+    return q16_add(p, d);
+}
+
+gu_q16 gu_proportional_integral_derivative_q16(const gu_q16 gain, const gu_q16 error, const gu_q16 errorGradient, const gu_q16 gradientGain, const gu_q16 errorTotal, const gu_q16 integralGain)
+{
+    const gu_q16 pd = gu_proportional_derivative_q16(gain, error, errorGradient, gradientGain);
+    return q16_add(pd, q16_mul(integralGain, errorTotal));
+}
+
+gu_control_q16 gu_p_control_q16(const gu_control_q16 value, const gu_controller_q16 controller, const gu_q16 reading, const gu_q16 time)
+{
+    return makeReadingQ16(value, controller, reading, time, ControlProportionalQ16);
+}
+
+gu_control_q16 gu_pd_control_q16(const gu_control_q16 value, const gu_controller_q16 controller, const gu_q16 reading, const gu_q16 time)
+{
+    return makeReadingQ16(value, controller, reading, time, ControlProportionalDerivativeQ16);
+}
+
+gu_control_q16 gu_pid_control_q16(const gu_control_q16 value, const gu_controller_q16 controller, const gu_q16 reading, const gu_q16 time)
+{
+    return makeReadingQ16(value, controller, reading, time, ControlProportionalIntegralDerivativeQ16);
+}
+
+gu_control_q16 gu_create_control_q16(const gu_q16 current, const gu_q16 target)
+{
+    gu_control_q16 control = {
+        target,
+        current,
+        q16_sub(target, current),
+        0,
+        0,
+        0
+    };
+    return control;
+}
@@ -0,0 +1,186 @@
+/*
+ * control_q16.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef CONTROL_Q16_H
+#define CONTROL_Q16_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A signed Q16.16 fixed-point number.
+ *
+ * The upper 16 bits hold the integer part and the lower 16 bits hold the
+ * fraction, giving a range of [-32768, 32768) with a resolution of 2^-16.
+ * All arithmetic saturates at the ends of the range instead of wrapping.
+ */
+typedef int32_t gu_q16;
+
+#define GU_Q16_ONE ((gu_q16) 0x10000)
+#define GU_Q16_MAX ((gu_q16) INT32_MAX)
+#define GU_Q16_MIN ((gu_q16) INT32_MIN)
+
+/**
+ * The Q16.16 equivalent of gu_control for targets without an FPU.
+ */
+typedef struct gu_control_q16 {
+    
+    /**
+     * The target we are heading towards.
+     */
+    gu_q16 target;
+
+    /**
+     * The current value.
+     */
+    gu_q16 current;
+
+    /**
+     * The error between the target and the current value.
+     */
+    gu_q16 error;
+    
+    /**
+     * The error before the current iteration of the control algorithm.
+     */
+    gu_q16 lastError;
+
+    /**
+     * The total error of all iterations of the control algorithm.
+     */
+    gu_q16 totalError;
+
+    gu_q16 controllerOutput;
+
+} gu_control_q16;
+
+/**
+ * The Q16.16 equivalent of gu_controller.
+ */
+typedef struct gu_controller_q16 {
+    
+    /**
+     * The proportional gain Kp.
+     */
+    gu_q16 proportionalGain;
+
+    /**
+     * The derivative gain Kd.
+     */
+    gu_q16 derivativeGain;
+
+    /**
+     * The integral gain Ki.
+     */
+    gu_q16 integralGain;
+
+} gu_controller_q16;
+
+/**
+ * Conversions between Q16.16 and other representations.
+ *
+ * The floating point conversions round to the nearest representable value
+ * and are intended for setting up gains and targets, not for use within
+ * the control loop itself.
+ */
+gu_q16 i_to_q16(const int32_t value) __attribute__((const));
+gu_q16 d_to_q16(const double value) __attribute__((const));
+gu_q16 f_to_q16(const float value) __attribute__((const));
+double q16_to_d(const gu_q16 value) __attribute__((const));
+float q16_to_f(const gu_q16 value) __attribute__((const));
+
+/**
+ * Saturating Q16.16 arithmetic.
+ *
+ * Multiplication and division round to nearest. Division by zero saturates
+ * towards the sign of the numerator.
+ */
+gu_q16 q16_add(const gu_q16 lhs, const gu_q16 rhs) __attribute__((const));
+gu_q16 q16_sub(const gu_q16 lhs, const gu_q16 rhs) __attribute__((const));
+gu_q16 q16_mul(const gu_q16 lhs, const gu_q16 rhs) __attribute__((const));
+gu_q16 q16_div(const gu_q16 lhs, const gu_q16 rhs) __attribute__((const));
+
+gu_control_q16 gu_create_control_q16(const gu_q16 current, const gu_q16 target) __attribute__((const));
+
+/**
+ * Q16.16 versions of gu_p_control, gu_pd_control and gu_pid_control.
+ */
+gu_control_q16 gu_p_control_q16(const gu_control_q16 value, const gu_controller_q16 controller, const gu_q16 reading, const gu_q16 time) __attribute__((const));
+gu_control_q16 gu_pd_control_q16(const gu_control_q16 value, const gu_controller_q16 controller, const gu_q16 reading, const gu_q16 time) __attribute__((const));
+gu_control_q16 gu_pid_control_q16(const gu_control_q16 value, const gu_controller_q16 controller, const gu_q16 reading, const gu_q16 time) __attribute__((const));
+
+gu_q16 gu_proportional_q16(const gu_q16 gain, const gu_q16 error) __attribute__((const));
+gu_q16 gu_proportional_derivative_q16(const gu_q16 gain, const gu_q16 error, const gu_q16 errorGradient, const gu_q16 gradientGain) __attribute__((const));
+gu_q16 gu_proportional_integral_derivative_q16(
+    const gu_q16 gain,
+    const gu_q16 error,
+    const gu_q16 errorGradient,
+    const gu_q16 gradientGain,
+    const gu_q16 errorTotal,
+    const gu_q16 integralGain
+) __attribute__((const));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* CONTROL_Q16_H */
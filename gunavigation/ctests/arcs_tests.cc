@@ -0,0 +1,202 @@
+/*
+ * arcs_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include "../Arcs.hpp"
+
+#include <climits>
+#include <vector>
+
+namespace CGTEST {
+    
+    class ArcsTests: public GUNavigationTests {};
+
+    TEST_F(ArcsTests, ArcForCoordinate) {
+        const gu_coordinate coordinate = {90, 100};
+        const gu_arc arc = arc_for_coordinate(coordinate);
+        ASSERT_EQ(arc.segmentLength, 157);
+        ASSERT_EQ(arc.maxTurnSpeed, 80);
+        ASSERT_EQ(arc.maxForwardSpeed, 80);
+        ASSERT_NEAR(arc.turnSteps, 90.0f / 80.0f, 0.00001f);
+        ASSERT_NEAR(arc.straightSteps, 100.0f * static_cast<float>(M_PI) / 2.0f / 8.0f, 0.0001f);
+        ASSERT_NEAR(rad_f_to_f(arc.theta), static_cast<float>(M_PI), 0.00001f);
+    }
+
+    TEST_F(ArcsTests, StraightAheadDrivesForward) {
+        const gu_coordinate coordinate = {0, 500};
+        const gu_arc arc = arc_for_coordinate(coordinate);
+        ASSERT_EQ(arc.segmentLength, 500);
+        const gu_arcspeed speed = arcspeed_to_coordinate(coordinate);
+        ASSERT_EQ(speed.turnSpeed, 0);
+        ASSERT_EQ(speed.forwardSpeed, 160);
+    }
+
+    TEST_F(ArcsTests, BehindTurnsOnTheSpot) {
+        const gu_coordinate coordinate = {-180, 500};
+        const gu_arcspeed speed = arcspeed_to_coordinate(coordinate);
+        ASSERT_EQ(speed.turnSpeed, -80);
+        ASSERT_EQ(speed.forwardSpeed, 0);
+        const gu_arc arc = arc_for_coordinate(coordinate);
+        ASSERT_EQ(arc.segmentLength, 0);
+        ASSERT_EQ(arc.straightSteps, 0.0f);
+        ASSERT_EQ(arc_for_coordinate_fast(coordinate).segmentLength, 0);
+        const gu_coordinate fullTurn = {360, 500};
+        ASSERT_EQ(arc_for_coordinate(fullTurn).segmentLength, 0);
+    }
+
+    TEST_F(ArcsTests, TurnOnTheSpotFollowsDirection) {
+        const gu_coordinate left = {45, 0};
+        const gu_coordinate right = {-45, 0};
+        ASSERT_EQ(arc_for_coordinate(right).straightSteps, 0.0f);
+        const gu_arcspeed leftSpeed = arcspeed_to_coordinate(left);
+        const gu_arcspeed rightSpeed = arcspeed_to_coordinate(right);
+        ASSERT_EQ(leftSpeed.turnSpeed, 10);
+        ASSERT_EQ(leftSpeed.forwardSpeed, 0);
+        ASSERT_EQ(rightSpeed.turnSpeed, -10);
+        ASSERT_EQ(rightSpeed.forwardSpeed, 0);
+        ASSERT_EQ(GU::ArcSpeed(right).turnSpeed, -10);
+    }
+
+    TEST_F(ArcsTests, NegativeDistanceUsesMagnitude) {
+        const gu_coordinate positive = {60, 300};
+        const gu_coordinate negative = {60, -300};
+        ASSERT_EQ(arc_for_coordinate(positive).segmentLength, arc_for_coordinate(negative).segmentLength);
+        ASSERT_EQ(arc_for_coordinate_fast(positive).segmentLength, arc_for_coordinate_fast(negative).segmentLength);
+        ASSERT_EQ(GU::Arc(positive).segmentLength, GU::Arc(negative).segmentLength);
+    }
+
+    TEST_F(ArcsTests, TurnDirectionFollowsCoordinate) {
+        const gu_coordinate left = {45, 300};
+        const gu_coordinate right = {-45, 300};
+        const gu_arcspeed leftSpeed = arcspeed_to_coordinate(left);
+        const gu_arcspeed rightSpeed = arcspeed_to_coordinate(right);
+        ASSERT_GT(leftSpeed.turnSpeed, 0);
+        ASSERT_EQ(leftSpeed.turnSpeed, -rightSpeed.turnSpeed);
+        ASSERT_EQ(leftSpeed.forwardSpeed, rightSpeed.forwardSpeed);
+    }
+
+    TEST_F(ArcsTests, FastArcWithinBound) {
+        for (int direction = -400; direction <= 400; direction++) {
+            for (int distance = 0; distance <= 1000; distance += 7) {
+                const gu_coordinate coordinate = {direction, distance};
+                const gu_arc exact = arc_for_coordinate(coordinate);
+                const gu_arc fast = arc_for_coordinate_fast(coordinate);
+                ASSERT_LE(abs(static_cast<int>(exact.segmentLength) - static_cast<int>(fast.segmentLength)), 1);
+                ASSERT_EQ(exact.maxTurnSpeed, fast.maxTurnSpeed);
+                ASSERT_EQ(exact.turnSteps, fast.turnSteps);
+                ASSERT_FLOAT_EQ(rad_f_to_f(exact.theta), rad_f_to_f(fast.theta));
+                ASSERT_TRUE(std::isfinite(exact.straightSteps));
+                ASSERT_LE(fabsf(exact.straightSteps - fast.straightSteps), exact.straightSteps * GU_ARC_FAST_MAX_RELATIVE_ERROR);
+                const gu_arcspeed exactSpeed = arcspeed_to_coordinate(coordinate);
+                const gu_arcspeed fastSpeed = arcspeed_to_coordinate_fast(coordinate);
+                ASSERT_LE(abs(exactSpeed.turnSpeed - fastSpeed.turnSpeed), 1);
+                ASSERT_LE(abs(exactSpeed.forwardSpeed - fastSpeed.forwardSpeed), 1);
+            }
+        }
+    }
+
+    TEST_F(ArcsTests, ExtremeDistancesUseTheirMagnitude) {
+        const gu_coordinate nearest = {30, INT_MIN};
+        const gu_coordinate furthest = {30, INT_MAX};
+        ASSERT_EQ(arc_for_coordinate(nearest).segmentLength, arc_for_coordinate(furthest).segmentLength);
+        ASSERT_EQ(arcspeed_to_coordinate(nearest).turnSpeed, arcspeed_to_coordinate(furthest).turnSpeed);
+        ASSERT_EQ(arcspeed_to_coordinate(nearest).forwardSpeed, arcspeed_to_coordinate(furthest).forwardSpeed);
+    }
+
+    TEST_F(ArcsTests, BatchMatchesFast) {
+        std::vector<gu_coordinate> coordinates;
+        for (int direction = -200; direction <= 200; direction++) {
+            for (int distance = -30; distance <= 1000; distance += 13) {
+                const gu_coordinate coordinate = {direction, distance};
+                coordinates.push_back(coordinate);
+            }
+        }
+        const size_t count = coordinates.size();
+        std::vector<gu_arcspeed> speeds(count);
+        arcspeed_to_coordinate_batch(coordinates.data(), speeds.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            const gu_arcspeed expected = arcspeed_to_coordinate_fast(coordinates[i]);
+            ASSERT_EQ(expected.turnSpeed, speeds[i].turnSpeed) << coordinates[i].direction << ", " << coordinates[i].distance;
+            ASSERT_EQ(expected.forwardSpeed, speeds[i].forwardSpeed) << coordinates[i].direction << ", " << coordinates[i].distance;
+        }
+    }
+
+    TEST_F(ArcsTests, BatchMatchesFastAtBoundaries) {
+        const int directions[] = {
+            INT_MIN, INT_MIN + 1, -360, -181, -180, -179, -91, -90, -89, -1, 0,
+            1, 89, 90, 91, 179, 180, 181, 360, INT_MAX
+        };
+        const int distances[] = {
+            INT_MIN, -INT_MAX, -65536, -4097, -4096, -321, -320, -319, -161, -160, -159, -1, 0,
+            1, 2, 159, 160, 161, 319, 320, 321, 4095, 4096, 4097, 65535, 65536, 1 << 24, INT_MAX
+        };
+        std::vector<gu_coordinate> coordinates;
+        for (size_t i = 0; i < sizeof(directions) / sizeof(directions[0]); i++) {
+            for (size_t j = 0; j < sizeof(distances) / sizeof(distances[0]); j++) {
+                const gu_coordinate coordinate = {directions[i], distances[j]};
+                coordinates.push_back(coordinate);
+            }
+        }
+        for (int direction = -179; direction <= 179; direction++) {
+            for (int distance = 0; distance <= 8192; distance += 1 + distance / 16) {
+                const gu_coordinate coordinate = {direction, distance};
+                coordinates.push_back(coordinate);
+            }
+        }
+        const size_t count = coordinates.size();
+        std::vector<gu_arcspeed> speeds(count);
+        arcspeed_to_coordinate_batch(coordinates.data(), speeds.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            const gu_arcspeed expected = arcspeed_to_coordinate_fast(coordinates[i]);
+            ASSERT_EQ(expected.turnSpeed, speeds[i].turnSpeed) << coordinates[i].direction << ", " << coordinates[i].distance;
+            ASSERT_EQ(expected.forwardSpeed, speeds[i].forwardSpeed) << coordinates[i].direction << ", " << coordinates[i].distance;
+        }
+    }
+
+    constexpr gu_coordinate kickApproach = {90, 100};
+
+    constexpr GU::Arc approachArcs[] = {
+        GU::Arc(kickApproach),
+        GU::Arc(gu_coordinate{0, 500}),
+        GU::Arc(gu_coordinate{-30, 250})
+    };
+
+    static_assert(approachArcs[0].segmentLength == 157, "Arc must be computed at compile time");
+    static_assert(approachArcs[1].segmentLength == 500, "Straight arcs keep their distance");
+    static_assert(GU::ArcSpeed(kickApproach).turnSpeed > 0, "ArcSpeed must be computed at compile time");
+
+    TEST_F(ArcsTests, ConstexprArcMatchesC) {
+        for (int direction = -400; direction <= 400; direction++) {
+            for (int distance = -20; distance <= 1000; distance += 7) {
+                const gu_coordinate coordinate = {direction, distance};
+                const gu_arc expected = arc_for_coordinate_fast(coordinate);
+                const GU::Arc actual(coordinate);
+                ASSERT_EQ(expected.segmentLength, actual.segmentLength);
+                ASSERT_EQ(expected.maxTurnSpeed, actual.maxTurnSpeed);
+                ASSERT_EQ(expected.maxForwardSpeed, actual.maxForwardSpeed);
+                ASSERT_EQ(expected.turnSteps, actual.turnSteps);
+                ASSERT_EQ(expected.straightSteps, actual.straightSteps);
+                ASSERT_EQ(rad_f_to_f(expected.theta), rad_f_to_f(actual.theta));
+                const gu_arcspeed expectedSpeed = arcspeed_to_coordinate_fast(coordinate);
+                const GU::ArcSpeed actualSpeed(coordinate);
+                ASSERT_EQ(expectedSpeed.turnSpeed, actualSpeed.turnSpeed);
+                ASSERT_EQ(expectedSpeed.forwardSpeed, actualSpeed.forwardSpeed);
+            }
+        }
+    }
+
+    TEST_F(ArcsTests, ConstexprTableMatchesRuntime) {
+        const gu_coordinate coordinates[] = {kickApproach, {0, 500}, {-30, 250}};
+        for (size_t i = 0; i < 3; i++) {
+            const GU::Arc runtime(coordinates[i]);
+            ASSERT_EQ(approachArcs[i].segmentLength, runtime.segmentLength);
+            ASSERT_EQ(approachArcs[i].straightSteps, runtime.straightSteps);
+            ASSERT_EQ(approachArcs[i].turnSteps, runtime.turnSteps);
+        }
+    }
+
+} //namespace
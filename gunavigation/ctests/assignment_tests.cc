@@ -0,0 +1,143 @@
+/*
+ * assignment_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+namespace CGTEST {
+    
+    class AssignmentTests: public GUNavigationTests {
+
+        protected:
+
+        std::unique_ptr<gu_assignment_workspace> workspace;
+
+        virtual void SetUp() {
+            workspace.reset(new gu_assignment_workspace);
+        }
+
+        static gu_cartesian_coordinate point(const millimetres_t x, const millimetres_t y) {
+            gu_cartesian_coordinate coordinate;
+            coordinate.x = x;
+            coordinate.y = y;
+            return coordinate;
+        }
+
+        static double distance(const gu_cartesian_coordinate from, const gu_cartesian_coordinate to) {
+            return hypot(static_cast<double>(to.x - from.x), static_cast<double>(to.y - from.y));
+        }
+
+    };
+
+    TEST_F(AssignmentTests, EmptyProblems) {
+        size_t assignments[1];
+        const gu_cartesian_coordinate tracks[1] = {point(0, 0)};
+        ASSERT_EQ(gu_assign_gated(workspace.get(), tracks, 1, NULL, 0, 100, assignments), 0u);
+        ASSERT_EQ(assignments[0], GU_ASSIGNMENT_NONE);
+        ASSERT_EQ(gu_assign_gated(workspace.get(), NULL, 0, tracks, 1, 100, NULL), 0u);
+    }
+
+    TEST_F(AssignmentTests, BeatsGreedyMatching) {
+        // Greedily the first track takes the sighting at 40, leaving the
+        // second track with none inside the gate.
+        const gu_cartesian_coordinate tracks[2] = {point(0, 0), point(100, 0)};
+        const gu_cartesian_coordinate sightings[2] = {point(40, 0), point(-50, 0)};
+        size_t assignments[2];
+        ASSERT_EQ(gu_assign_gated(workspace.get(), tracks, 2, sightings, 2, 120, assignments), 2u);
+        ASSERT_EQ(assignments[0], 1u);
+        ASSERT_EQ(assignments[1], 0u);
+    }
+
+    TEST_F(AssignmentTests, RespectsGate) {
+        const gu_cartesian_coordinate tracks[2] = {point(0, 0), point(5000, 0)};
+        const gu_cartesian_coordinate sightings[2] = {point(5050, 0), point(1000, 0)};
+        size_t assignments[2];
+        ASSERT_EQ(gu_assign_gated(workspace.get(), tracks, 2, sightings, 2, 300, assignments), 1u);
+        ASSERT_EQ(assignments[0], GU_ASSIGNMENT_NONE);
+        ASSERT_EQ(assignments[1], 0u);
+    }
+
+    TEST_F(AssignmentTests, ZeroGateAssignsExactMatches) {
+        const gu_cartesian_coordinate tracks[3] = {point(0, 0), point(0, 0), point(500, 0)};
+        const gu_cartesian_coordinate sightings[3] = {point(0, 0), point(0, 0), point(501, 0)};
+        size_t assignments[3];
+        ASSERT_EQ(gu_assign_gated(workspace.get(), tracks, 3, sightings, 3, 0, assignments), 2u);
+        ASSERT_NE(assignments[0], GU_ASSIGNMENT_NONE);
+        ASSERT_NE(assignments[1], GU_ASSIGNMENT_NONE);
+        ASSERT_NE(assignments[0], assignments[1]);
+        ASSERT_EQ(assignments[2], GU_ASSIGNMENT_NONE);
+    }
+
+    TEST_F(AssignmentTests, MoreTracksThanSightings) {
+        const gu_cartesian_coordinate tracks[3] = {point(0, 0), point(100, 0), point(200, 0)};
+        const gu_cartesian_coordinate sightings[2] = {point(190, 0), point(110, 0)};
+        size_t assignments[3];
+        ASSERT_EQ(gu_assign_gated(workspace.get(), tracks, 3, sightings, 2, 150, assignments), 2u);
+        ASSERT_EQ(assignments[0], GU_ASSIGNMENT_NONE);
+        ASSERT_EQ(assignments[1], 1u);
+        ASSERT_EQ(assignments[2], 0u);
+    }
+
+    TEST_F(AssignmentTests, MatchesExhaustiveSearch) {
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<int> coordinate(-400, 400);
+        const size_t count = 6;
+        for (int trial = 0; trial < 50; trial++) {
+            gu_cartesian_coordinate tracks[count];
+            gu_cartesian_coordinate sightings[count];
+            for (size_t i = 0; i < count; i++) {
+                tracks[i] = point(coordinate(generator), coordinate(generator));
+                sightings[i] = point(coordinate(generator), coordinate(generator));
+            }
+            size_t assignments[count];
+            ASSERT_EQ(gu_assign_gated(workspace.get(), tracks, count, sightings, count, 2000, assignments), count);
+            double total = 0.0;
+            for (size_t i = 0; i < count; i++) {
+                total += distance(tracks[i], sightings[assignments[i]]);
+            }
+            size_t permutation[count] = {0, 1, 2, 3, 4, 5};
+            double best = HUGE_VAL;
+            do {
+                double candidate = 0.0;
+                for (size_t i = 0; i < count; i++) {
+                    candidate += distance(tracks[i], sightings[permutation[i]]);
+                }
+                best = std::min(best, candidate);
+            } while (std::next_permutation(permutation, permutation + count));
+            ASSERT_NEAR(total, best, 0.000001);
+        }
+    }
+
+    TEST_F(AssignmentTests, ObjectTrackerKeepsCrossingObjectsApart) {
+        std::unique_ptr<gu_object_tracker> tracker(new gu_object_tracker);
+        const gu_object_tracker_parameters parameters = {100.0, 400.0, 120, 3, true};
+        ASSERT_TRUE(gu_object_tracker_init(tracker.get(), parameters));
+        const gu_field_coordinate origin = {{0, 0}, 0};
+        const gu_cartesian_coordinate first[2] = {point(1000, 0), point(1100, 0)};
+        gu_sighting sightings[2];
+        for (size_t i = 0; i < 2; i++) {
+            sightings[i].location = cartesian_coord_to_rr_coord(first[i]);
+            sightings[i].frameNumber = 1;
+        }
+        gu_object_tracker_update(tracker.get(), origin, origin, sightings, 2, 1);
+        const gu_cartesian_coordinate second[2] = {point(1040, 0), point(950, 0)};
+        for (size_t i = 0; i < 2; i++) {
+            sightings[i].location = cartesian_coord_to_rr_coord(second[i]);
+            sightings[i].frameNumber = 2;
+        }
+        ASSERT_EQ(gu_object_tracker_update(tracker.get(), origin, origin, sightings, 2, 2), 2u);
+        ASSERT_EQ(tracker->count, 2u);
+        ASSERT_LT(tracker->x[0], 1000.0);
+        ASSERT_GT(tracker->x[1], 1000.0);
+    }
+
+} //namespace
@@ -0,0 +1,98 @@
+/*
+ * control_precision_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+
+namespace CGTEST {
+    
+    class ControlPrecisionTests: public GUNavigationTests {
+
+        protected:
+
+        typedef gu_control (*double_control)(const gu_control, const gu_controller, const double, const double);
+        typedef gu_control_f (*float_control)(const gu_control_f, const gu_controller_f, const float, const float);
+        typedef gu_control_q16 (*q16_control)(const gu_control_q16, const gu_controller_q16, const gu_q16, const gu_q16);
+
+        /**
+         * Drive a simple plant with each implementation and bound the
+         * difference in controller output against the double version.
+         *
+         * The Q16.16 bound is dominated by the quantisation of dt, which
+         * accumulates in the integral term over the 500 iterations.
+         */
+        void compare(double_control dFunction, float_control fFunction, q16_control qFunction, const double floatTolerance, const double q16Tolerance) {
+            const gu_controller dController = {0.5, 0.05, 0.1};
+            const gu_controller_f fController = {0.5f, 0.05f, 0.1f};
+            const gu_controller_q16 qController = {d_to_q16(0.5), d_to_q16(0.05), d_to_q16(0.1)};
+            const double dt = 0.01;
+            gu_control dValue = gu_create_control(-20.0, 15.0);
+            gu_control_f fValue = gu_create_control_f(-20.0f, 15.0f);
+            gu_control_q16 qValue = gu_create_control_q16(d_to_q16(-20.0), d_to_q16(15.0));
+            double reading = -20.0;
+            for (int i = 0; i < 500; i++) {
+                reading += dValue.controllerOutput * dt * 10.0 + 0.05 * sin(static_cast<double>(i) * 0.1);
+                dValue = dFunction(dValue, dController, reading, dt);
+                fValue = fFunction(fValue, fController, static_cast<float>(reading), static_cast<float>(dt));
+                qValue = qFunction(qValue, qController, d_to_q16(reading), d_to_q16(dt));
+                ASSERT_NEAR(dValue.error, static_cast<double>(fValue.error), floatTolerance);
+                ASSERT_NEAR(dValue.totalError, static_cast<double>(fValue.totalError), floatTolerance);
+                ASSERT_NEAR(dValue.controllerOutput, static_cast<double>(fValue.controllerOutput), floatTolerance);
+                ASSERT_NEAR(dValue.error, q16_to_d(qValue.error), q16Tolerance);
+                ASSERT_NEAR(dValue.totalError, q16_to_d(qValue.totalError), q16Tolerance);
+                ASSERT_NEAR(dValue.controllerOutput, q16_to_d(qValue.controllerOutput), q16Tolerance);
+            }
+        }
+
+    };
+
+    TEST_F(ControlPrecisionTests, Q16Conversions) {
+        ASSERT_EQ(GU_Q16_ONE, i_to_q16(1));
+        ASSERT_EQ(-3 * GU_Q16_ONE, i_to_q16(-3));
+        ASSERT_EQ(GU_Q16_ONE / 2, d_to_q16(0.5));
+        ASSERT_EQ(-GU_Q16_ONE / 4, f_to_q16(-0.25f));
+        ASSERT_NEAR(1.5, q16_to_d(d_to_q16(1.5)), 0.00001);
+        ASSERT_EQ(GU_Q16_MAX, d_to_q16(40000.0));
+        ASSERT_EQ(GU_Q16_MIN, d_to_q16(-40000.0));
+    }
+
+    TEST_F(ControlPrecisionTests, Q16Arithmetic) {
+        ASSERT_EQ(d_to_q16(3.75), q16_add(d_to_q16(1.5), d_to_q16(2.25)));
+        ASSERT_EQ(d_to_q16(-0.75), q16_sub(d_to_q16(1.5), d_to_q16(2.25)));
+        ASSERT_EQ(d_to_q16(-3.375), q16_mul(d_to_q16(-1.5), d_to_q16(2.25)));
+        ASSERT_EQ(d_to_q16(-2.5), q16_div(d_to_q16(5.0), d_to_q16(-2.0)));
+        ASSERT_EQ(GU_Q16_MAX, q16_add(GU_Q16_MAX, GU_Q16_ONE));
+        ASSERT_EQ(GU_Q16_MIN, q16_mul(i_to_q16(-30000), i_to_q16(2)));
+        ASSERT_EQ(GU_Q16_MAX, q16_div(GU_Q16_ONE, 0));
+        ASSERT_EQ(GU_Q16_MIN, q16_div(-GU_Q16_ONE, 0));
+        ASSERT_NEAR(1.0 / 3.0, q16_to_d(q16_div(GU_Q16_ONE, i_to_q16(3))), 1.0 / 65536.0);
+    }
+
+    TEST_F(ControlPrecisionTests, FloatControlMatchesDouble) {
+        const gu_control_f val = gu_create_control_f(0.0f, 6.0f);
+        const gu_controller_f controller = {0.5f, 0.1f, 0.1f};
+        const gu_control_f actual = gu_pid_control_f(val, controller, 5.0f, 0.5f);
+        ASSERT_NEAR(6.0f, actual.target, 0.00001f);
+        ASSERT_NEAR(5.0f, actual.current, 0.00001f);
+        ASSERT_NEAR(1.0f, actual.error, 0.00001f);
+        ASSERT_NEAR(6.0f, actual.lastError, 0.00001f);
+        ASSERT_NEAR(0.5f, actual.totalError, 0.00001f);
+        ASSERT_NEAR(-0.45f, actual.controllerOutput, 0.00001f);
+    }
+
+    TEST_F(ControlPrecisionTests, PControlErrorBound) {
+        compare(gu_p_control, gu_p_control_f, gu_p_control_q16, 0.0005, 0.01);
+    }
+
+    TEST_F(ControlPrecisionTests, PDControlErrorBound) {
+        compare(gu_pd_control, gu_pd_control_f, gu_pd_control_q16, 0.005, 0.05);
+    }
+
+    TEST_F(ControlPrecisionTests, PIDControlErrorBound) {
+        compare(gu_pid_control, gu_pid_control_f, gu_pid_control_q16, 0.005, 0.05);
+    }
+
+} //namespace
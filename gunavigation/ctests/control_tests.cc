@@ -219,4 +219,53 @@ namespace CGTEST {
         ASSERT_NEAR(expected.controllerOutput, actual.controllerOutput, 0.00001);
     }
 
+    static void assertBitIdentical(const gu_control expected, const gu_control actual) {
+        ASSERT_EQ(expected.target, actual.target);
+        ASSERT_EQ(expected.current, actual.current);
+        ASSERT_EQ(expected.error, actual.error);
+        ASSERT_EQ(expected.lastError, actual.lastError);
+        ASSERT_EQ(expected.totalError, actual.totalError);
+        ASSERT_EQ(expected.controllerOutput, actual.controllerOutput);
+    }
+
+    TEST_F(ControlTests, BatchControlMatchesSingleControl) {
+        const size_t count = 37;
+        double target[count], current[count], error[count], lastError[count], totalError[count], controllerOutput[count];
+        double proportionalGain[count], derivativeGain[count], integralGain[count];
+        double readings[count], times[count];
+        gu_control singles[count];
+        gu_controller controllers[count];
+        const gu_control_batch batch = {target, current, error, lastError, totalError, controllerOutput};
+        const gu_controller_batch gains = {proportionalGain, derivativeGain, integralGain};
+        for (size_t i = 0; i < count; i++) {
+            const double d = static_cast<double>(i);
+            singles[i] = gu_create_control(d * 0.3 - 4.0, 6.0 - d * 0.7);
+            const gu_controller controller = {0.5 + d * 0.01, 0.1 + d * 0.003, 0.1 - d * 0.002};
+            controllers[i] = controller;
+            proportionalGain[i] = controller.proportionalGain;
+            derivativeGain[i] = controller.derivativeGain;
+            integralGain[i] = controller.integralGain;
+            gu_control_batch_set(batch, i, singles[i]);
+        }
+        for (int iteration = 0; iteration < 10; iteration++) {
+            for (size_t i = 0; i < count; i++) {
+                readings[i] = singles[i].current + singles[i].controllerOutput + sin(static_cast<double>(i + iteration));
+                times[i] = 0.01 + 0.001 * static_cast<double>(i % 7);
+                switch (iteration % 3) {
+                    case 0: singles[i] = gu_p_control(singles[i], controllers[i], readings[i], times[i]); break;
+                    case 1: singles[i] = gu_pd_control(singles[i], controllers[i], readings[i], times[i]); break;
+                    default: singles[i] = gu_pid_control(singles[i], controllers[i], readings[i], times[i]); break;
+                }
+            }
+            switch (iteration % 3) {
+                case 0: gu_p_control_batch(batch, gains, readings, times, count); break;
+                case 1: gu_pd_control_batch(batch, gains, readings, times, count); break;
+                default: gu_pid_control_batch(batch, gains, readings, times, count); break;
+            }
+            for (size_t i = 0; i < count; i++) {
+                assertBitIdentical(singles[i], gu_control_batch_get(batch, i));
+            }
+        }
+    }
+
 }  // namespace
@@ -0,0 +1,70 @@
+/*
+ * controller_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include "../Controller.hpp"
+
+namespace CGTEST {
+    
+    class ControllerTests: public GUNavigationTests {
+
+        protected:
+
+        template <GU::ControlAlgorithm Algorithm>
+        void compareWithC(gu_control (*cFunction)(const gu_control, const gu_controller, const double, const double)) {
+            const gu_controller controller = {0.5, 0.1, 0.1};
+            const GU::Controller<Algorithm, double> cppController(controller);
+            gu_control cValue = gu_create_control(0.0, 6.0);
+            GU::ControlState<double> cppValue = GU::ControlState<double>::create(0.0, 6.0);
+            for (int i = 0; i < 20; i++) {
+                const double reading = cValue.current + cValue.controllerOutput;
+                const double dt = 0.5;
+                cValue = cFunction(cValue, controller, reading, dt);
+                cppValue = cppController.step(cppValue, reading, dt);
+                ASSERT_NEAR(cValue.target, cppValue.target, 0.00001);
+                ASSERT_NEAR(cValue.current, cppValue.current, 0.00001);
+                ASSERT_NEAR(cValue.error, cppValue.error, 0.00001);
+                ASSERT_NEAR(cValue.lastError, cppValue.lastError, 0.00001);
+                ASSERT_NEAR(cValue.totalError, cppValue.totalError, 0.00001);
+                ASSERT_NEAR(cValue.controllerOutput, cppValue.controllerOutput, 0.00001);
+            }
+        }
+
+    };
+
+    TEST_F(ControllerTests, PControlMatchesC) {
+        compareWithC<GU::Proportional>(gu_p_control);
+    }
+
+    TEST_F(ControllerTests, PDControlMatchesC) {
+        compareWithC<GU::ProportionalDerivative>(gu_pd_control);
+    }
+
+    TEST_F(ControllerTests, PIDControlMatchesC) {
+        compareWithC<GU::ProportionalIntegralDerivative>(gu_pid_control);
+    }
+
+    TEST_F(ControllerTests, PIDControlAtCompileTime) {
+        constexpr GU::PIDController controller(0.5, 0.1, 0.1);
+        constexpr GU::ControlState<double> initial = GU::ControlState<double>::create(0.0, 6.0);
+        constexpr GU::ControlState<double> actual = controller.step(initial, 5.0, 0.5);
+        static_assert(actual.current == 5.0, "Controller::step must be usable in constant expressions.");
+        ASSERT_NEAR(6.0, actual.target, 0.00001);
+        ASSERT_NEAR(1.0, actual.error, 0.00001);
+        ASSERT_NEAR(6.0, actual.lastError, 0.00001);
+        ASSERT_NEAR(0.5, actual.totalError, 0.00001);
+        ASSERT_NEAR(-0.45, actual.controllerOutput, 0.00001);
+    }
+
+    TEST_F(ControllerTests, SinglePrecisionPControl) {
+        const GU::PControllerf controller(0.5f);
+        const GU::ControlState<float> actual = controller.step(GU::ControlState<float>::create(0.0f, 6.0f), 5.0f, 1.0f);
+        ASSERT_NEAR(1.0f, actual.error, 0.00001f);
+        ASSERT_NEAR(0.5f, actual.controllerOutput, 0.00001f);
+    }
+
+} //namespace
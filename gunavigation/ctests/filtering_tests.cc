@@ -14,6 +14,121 @@ namespace CGTEST {
     
     class FilteringTests: public GUNavigationTests {};
 
+    TEST_F(FilteringTests, KalmanFilter) {
+        const gu_kalman_object object = {10.0, 4.0};
+        const gu_kalman_object expectedChange = {2.0, 1.0};
+        const gu_kalman_object sensorReading = {14.0, 5.0};
+        const gu_kalman_object actual = kalman_filter(object, expectedChange, sensorReading);
+        ASSERT_NEAR(13.0, actual.observable, 0.00001);
+        ASSERT_NEAR(2.5, actual.variance, 0.00001);
+    }
 
+    TEST_F(FilteringTests, KalmanFilterSteadyState) {
+        const gu_kalman_object initial = {0.0, 100.0};
+        const gu_kalman_filter filter = gu_kalman_filter_create(initial, 2.0, 8.0);
+        // M^2 - 2M - 16 = 0 => M = 1 + sqrt(17), K = M / (M + 8).
+        const double expectedVariance = 1.0 + sqrt(17.0);
+        ASSERT_NEAR(expectedVariance / (expectedVariance + 8.0), filter.steadyStateGain, 0.000000001);
+        ASSERT_NEAR(8.0 * expectedVariance / (expectedVariance + 8.0), filter.steadyStateVariance, 0.000000001);
+        ASSERT_FALSE(filter.converged);
+    }
+
+    TEST_F(FilteringTests, KalmanFilterMatchesKalmanFilterFunction) {
+        gu_kalman_object expected = {0.0, 100.0};
+        gu_kalman_filter filter = gu_kalman_filter_create(expected, 2.0, 8.0);
+        bool converged = false;
+        for (int i = 0; i < 200; i++) {
+            const double change = sin(static_cast<double>(i) * 0.1);
+            const double reading = expected.observable + change + cos(static_cast<double>(i));
+            const gu_kalman_object expectedChange = {change, 2.0};
+            const gu_kalman_object sensorReading = {reading, 8.0};
+            expected = kalman_filter(expected, expectedChange, sensorReading);
+            filter = gu_kalman_filter_update(filter, change, reading);
+            converged = converged || filter.converged;
+            ASSERT_NEAR(expected.observable, filter.state.observable, 0.000001);
+            ASSERT_NEAR(expected.variance, filter.state.variance, 0.000001);
+        }
+        ASSERT_TRUE(converged);
+    }
+
+    TEST_F(FilteringTests, KalmanFilterResetsWhenVariancesChange) {
+        const gu_kalman_object initial = {0.0, 1.0};
+        gu_kalman_filter filter = gu_kalman_filter_create(initial, 1.0, 1.0);
+        for (int i = 0; i < 100; i++) {
+            filter = gu_kalman_filter_update(filter, 0.0, 1.0);
+        }
+        ASSERT_TRUE(filter.converged);
+        filter = gu_kalman_filter_set_variances(filter, 4.0, 0.5);
+        ASSERT_FALSE(filter.converged);
+        gu_kalman_object expected = filter.state;
+        for (int i = 0; i < 100; i++) {
+            const gu_kalman_object expectedChange = {0.0, 4.0};
+            const gu_kalman_object sensorReading = {2.0, 0.5};
+            expected = kalman_filter(expected, expectedChange, sensorReading);
+            filter = gu_kalman_filter_update(filter, 0.0, 2.0);
+            ASSERT_NEAR(expected.observable, filter.state.observable, 0.000001);
+            ASSERT_NEAR(expected.variance, filter.state.variance, 0.000001);
+        }
+        ASSERT_TRUE(filter.converged);
+    }
+
+    TEST_F(FilteringTests, KalmanFilterBankMatchesKalmanFilter) {
+        const size_t count = 33;
+        double observable[count], variance[count];
+        double changeObservable[count], changeVariance[count];
+        double readingObservable[count], readingVariance[count];
+        uint8_t valid[count];
+        gu_kalman_object expected[count];
+        const gu_kalman_bank objects = {observable, variance};
+        const gu_kalman_bank changes = {changeObservable, changeVariance};
+        const gu_kalman_bank readings = {readingObservable, readingVariance};
+        for (size_t i = 0; i < count; i++) {
+            const double d = static_cast<double>(i);
+            observable[i] = d;
+            variance[i] = 1.0 + d * 0.5;
+            expected[i].observable = observable[i];
+            expected[i].variance = variance[i];
+            changeVariance[i] = 0.25 + d * 0.01;
+            readingVariance[i] = 2.0 + d * 0.1;
+        }
+        for (int frame = 0; frame < 20; frame++) {
+            for (size_t i = 0; i < count; i++) {
+                const double d = static_cast<double>(i);
+                changeObservable[i] = sin(d + frame);
+                valid[i] = (i + static_cast<size_t>(frame)) % 3 != 0 ? 1 : 0;
+                readingObservable[i] = valid[i] ? d + cos(d * frame) : 1.0e6;
+                const gu_kalman_object change = {changeObservable[i], changeVariance[i]};
+                const gu_kalman_object reading = {readingObservable[i], readingVariance[i]};
+                if (valid[i]) {
+                    expected[i] = kalman_filter(expected[i], change, reading);
+                } else {
+                    expected[i].observable += change.observable;
+                    expected[i].variance += change.variance;
+                }
+            }
+            kalman_filter_bank(objects, changes, readings, valid, count);
+            for (size_t i = 0; i < count; i++) {
+                ASSERT_EQ(expected[i].observable, observable[i]);
+                ASSERT_EQ(expected[i].variance, variance[i]);
+            }
+        }
+    }
+
+    TEST_F(FilteringTests, KalmanFilterBankWithoutMask) {
+        double observable[2] = {10.0, 0.0};
+        double variance[2] = {4.0, 1.0};
+        double changeObservable[2] = {2.0, 0.0};
+        double changeVariance[2] = {1.0, 1.0};
+        double readingObservable[2] = {14.0, 2.0};
+        double readingVariance[2] = {5.0, 2.0};
+        const gu_kalman_bank objects = {observable, variance};
+        const gu_kalman_bank changes = {changeObservable, changeVariance};
+        const gu_kalman_bank readings = {readingObservable, readingVariance};
+        kalman_filter_bank(objects, changes, readings, NULL, 2);
+        ASSERT_NEAR(13.0, observable[0], 0.00001);
+        ASSERT_NEAR(2.5, variance[0], 0.00001);
+        ASSERT_NEAR(1.0, observable[1], 0.00001);
+        ASSERT_NEAR(1.0, variance[1], 0.00001);
+    }
 
 } //namespace
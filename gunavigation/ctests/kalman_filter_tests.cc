@@ -0,0 +1,113 @@
+/*
+ * kalman_filter_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include "../KalmanFilter.hpp"
+
+namespace CGTEST {
+    
+    class KalmanFilterTests: public GUNavigationTests {};
+
+    TEST_F(KalmanFilterTests, InvertMatchesIdentity) {
+        GU::Matrix<3, 3> matrix = GU::Matrix<3, 3>::zero();
+        matrix(0, 1) = 2.0;
+        matrix(1, 0) = 4.0;
+        matrix(1, 2) = 1.0;
+        matrix(2, 2) = 3.0;
+        GU::Matrix<3, 3> inverse;
+        ASSERT_TRUE(GU::invert(matrix, inverse));
+        const GU::Matrix<3, 3> product = matrix * inverse;
+        for (size_t i = 0; i < 3; i++) {
+            for (size_t j = 0; j < 3; j++) {
+                ASSERT_NEAR(product(i, j), i == j ? 1.0 : 0.0, 1.0e-12);
+            }
+        }
+        ASSERT_FALSE(GU::invert(GU::Matrix<3, 3>::zero(), inverse));
+    }
+
+    TEST_F(KalmanFilterTests, ScalarFilterMatchesKalmanFilter) {
+        gu_kalman_object object = {10.0, 4.0};
+        GU::KalmanFilter<1, 1>::StateVector state;
+        state(0, 0) = object.observable;
+        GU::KalmanFilter<1, 1>::StateMatrix covariance;
+        covariance(0, 0) = object.variance;
+        GU::KalmanFilter<1, 1> filter(state, covariance);
+        for (int i = 0; i < 20; i++) {
+            const gu_kalman_object change = {1.0, 0.5};
+            const gu_kalman_object reading = {10.0 + i * 1.1, 2.0};
+            object = kalman_filter(object, change, reading);
+            GU::KalmanFilter<1, 1>::StateMatrix transition = GU::KalmanFilter<1, 1>::StateMatrix::identity();
+            GU::KalmanFilter<1, 1>::StateMatrix noise;
+            noise(0, 0) = change.variance;
+            GU::KalmanFilter<1, 1>::StateVector predicted;
+            predicted(0, 0) = filter.state()(0, 0) + change.observable;
+            filter.predict(predicted, transition, noise);
+            GU::KalmanFilter<1, 1>::MeasurementVector measurement;
+            measurement(0, 0) = reading.observable;
+            GU::KalmanFilter<1, 1>::MeasurementMatrix sensorNoise;
+            sensorNoise(0, 0) = reading.variance;
+            ASSERT_TRUE(filter.update(measurement, GU::KalmanFilter<1, 1>::ObservationMatrix::identity(), sensorNoise));
+            ASSERT_NEAR(filter.state()(0, 0), object.observable, 1.0e-9);
+            ASSERT_NEAR(filter.covariance()(0, 0), object.variance, 1.0e-9);
+        }
+    }
+
+    TEST_F(KalmanFilterTests, PosePredictionFollowsTrack) {
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 3};
+        const gu_relative_coordinate target = {0.0, 0};
+        gu_odometry_status status = create_status(initialReading, target);
+        GU::PoseFilter<double> filter(status.my_position, initialReading, GU::Matrix<3, 3>::identity(), 0.01, 0.001);
+        millimetres_t forward = 0;
+        double turn = 0.0;
+        uint8_t resetCounter = 3;
+        for (int i = 0; i < 100; i++) {
+            if (i % 30 == 29) {
+                resetCounter++;
+                forward = 0;
+                turn = 0.0;
+            }
+            forward += 20;
+            turn += deg_d_to_rad_d(2.0);
+            const gu_odometry_reading reading = {forward, 0, turn, resetCounter};
+            status = track(reading, status);
+            filter.predict(reading);
+        }
+        // track() rounds to whole millimetres and degrees every step, the
+        // filter does not, so the turns are whole degrees.
+        ASSERT_NEAR(filter.x(), static_cast<double>(status.my_position.position.x), 100.0);
+        ASSERT_NEAR(filter.y(), static_cast<double>(status.my_position.position.y), 100.0);
+        ASSERT_NEAR(filter.heading(), deg_d_to_rad_d(200.0), 1.0e-9);
+        ASSERT_GT(filter.filter().covariance()(0, 0), 1.0);
+    }
+
+    TEST_F(KalmanFilterTests, PositionUpdateReducesUncertainty) {
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_field_coordinate initial = {{0, 0}, 0};
+        GU::Matrix<3, 3> covariance = GU::Matrix<3, 3>::identity();
+        covariance(0, 0) = 100.0;
+        covariance(1, 1) = 100.0;
+        GU::PoseFilter<double> filter(initial, initialReading, covariance, 0.01, 0.001);
+        const gu_cartesian_coordinate fix = {50, -50};
+        ASSERT_TRUE(filter.updatePosition(fix, 100.0));
+        ASSERT_NEAR(filter.x(), 25.0, 1.0e-9);
+        ASSERT_NEAR(filter.y(), -25.0, 1.0e-9);
+        ASSERT_NEAR(filter.heading(), 0.0, 1.0e-9);
+        ASSERT_NEAR(filter.filter().covariance()(0, 0), 50.0, 1.0e-9);
+        ASSERT_NEAR(filter.filter().covariance()(2, 2), 1.0, 1.0e-9);
+    }
+
+    TEST_F(KalmanFilterTests, PoseUpdateWrapsHeading) {
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_field_coordinate initial = {{0, 0}, 170};
+        GU::PoseFilter<double> filter(initial, initialReading, GU::Matrix<3, 3>::identity(), 0.01, 0.001);
+        const gu_field_coordinate observed = {{0, 0}, -170};
+        ASSERT_TRUE(filter.updatePose(observed, GU::Matrix<3, 3>::identity()));
+        ASSERT_NEAR(filter.heading(), deg_d_to_rad_d(180.0), 1.0e-9);
+        ASSERT_EQ(filter.fieldCoordinate().heading, 180);
+    }
+
+} //namespace
@@ -0,0 +1,202 @@
+/*
+ * localisation_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include "../LocalisationWorkers.hpp"
+
+#include <memory>
+
+namespace CGTEST {
+    
+    class LocalisationTests: public GUNavigationTests {
+
+        protected:
+
+        std::unique_ptr<gu_mcl> mcl;
+
+        gu_odometry_reading initialReading;
+
+        virtual void SetUp() {
+            mcl.reset(new gu_mcl);
+            initialReading = reading(0, 0, 0.0);
+        }
+
+        static gu_odometry_reading reading(const millimetres_t forward, const millimetres_t left, const radians_d turn) {
+            gu_odometry_reading value;
+            value.forward = forward;
+            value.left = left;
+            value.turn = turn;
+            value.resetCounter = 0;
+            return value;
+        }
+
+        static gu_field_coordinate pose(const millimetres_t x, const millimetres_t y, const degrees_t heading) {
+            gu_field_coordinate coordinate;
+            coordinate.position.x = x;
+            coordinate.position.y = y;
+            coordinate.heading = heading;
+            return coordinate;
+        }
+
+        static gu_mcl_noise noise(const double amount) {
+            const gu_mcl_noise value = {amount, amount, amount, amount * 0.001};
+            return value;
+        }
+
+    };
+
+    TEST_F(LocalisationTests, InitRejectsInvalidCount) {
+        ASSERT_FALSE(gu_mcl_init(mcl.get(), 0, pose(0, 0, 0), 0.0, 0.0, initialReading, noise(0.0), 1));
+        ASSERT_FALSE(gu_mcl_init(mcl.get(), GU_MCL_MAX_PARTICLES + 1, pose(0, 0, 0), 0.0, 0.0, initialReading, noise(0.0), 1));
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 10, pose(100, -200, 90), 0.0, 0.0, initialReading, noise(0.0), 1));
+        ASSERT_NEAR(mcl->x[3], 100.0, 0.000001);
+        ASSERT_NEAR(mcl->y[3], -200.0, 0.000001);
+        ASSERT_NEAR(mcl->heading[3], M_PI / 2.0, 0.000001);
+        ASSERT_NEAR(mcl->weight[9], 0.1, 0.000001);
+    }
+
+    TEST_F(LocalisationTests, NoiselessPredictMatchesTrackPrecise) {
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 16, pose(0, 0, 0), 0.0, 0.0, initialReading, noise(0.0), 1));
+        const gu_relative_coordinate target = {0.0, 0};
+        gu_precise_odometry_status status = create_precise_status(create_status(initialReading, target));
+        for (int step = 1; step <= 200; step++) {
+            const gu_odometry_reading next = reading(step * 10, step * 2, 0.01 * static_cast<double>(step));
+            gu_mcl_predict(mcl.get(), next);
+            status = track_precise(next, status);
+        }
+        for (size_t i = 0; i < mcl->count; i++) {
+            ASSERT_NEAR(mcl->x[i], status.x, 0.001);
+            ASSERT_NEAR(mcl->y[i], status.y, 0.001);
+        }
+        const gu_field_coordinate estimate = gu_mcl_estimate(mcl.get());
+        ASSERT_EQ(estimate.heading, precise_status_position(status).heading);
+    }
+
+    TEST_F(LocalisationTests, NoiseSpreadsParticles) {
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 512, pose(0, 0, 0), 0.0, 0.0, initialReading, noise(0.1), 1));
+        gu_mcl_predict(mcl.get(), reading(1000, 0, 0.0));
+        double mean = 0.0;
+        for (size_t i = 0; i < mcl->count; i++) {
+            mean += mcl->x[i];
+        }
+        mean /= static_cast<double>(mcl->count);
+        double variance = 0.0;
+        for (size_t i = 0; i < mcl->count; i++) {
+            variance += (mcl->x[i] - mean) * (mcl->x[i] - mean);
+        }
+        variance /= static_cast<double>(mcl->count);
+        ASSERT_NEAR(mean, 1000.0, 20.0);
+        ASSERT_GT(sqrt(variance), 50.0);
+        ASSERT_LT(sqrt(variance), 150.0);
+    }
+
+    TEST_F(LocalisationTests, RangesMatchWholeUpdate) {
+        std::unique_ptr<gu_mcl> split(new gu_mcl);
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 100, pose(0, 0, 0), 50.0, 0.1, initialReading, noise(0.05), 9));
+        ASSERT_TRUE(gu_mcl_init(split.get(), 100, pose(0, 0, 0), 50.0, 0.1, initialReading, noise(0.05), 9));
+        const gu_odometry_reading next = reading(300, 20, 0.2);
+        gu_mcl_predict(mcl.get(), next);
+        const gu_mcl_motion motion = gu_mcl_motion_between(next, initialReading);
+        gu_mcl_predict_range(split.get(), motion, 37, 100);
+        gu_mcl_predict_range(split.get(), motion, 0, 37);
+        for (size_t i = 0; i < 100; i++) {
+            ASSERT_EQ(mcl->x[i], split->x[i]);
+            ASSERT_EQ(mcl->y[i], split->y[i]);
+            ASSERT_EQ(mcl->heading[i], split->heading[i]);
+        }
+    }
+
+    TEST_F(LocalisationTests, WorkersMatchPredict) {
+        std::unique_ptr<gu_mcl> threaded(new gu_mcl);
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 1000, pose(0, 0, 0), 50.0, 0.1, initialReading, noise(0.05), 3));
+        ASSERT_TRUE(gu_mcl_init(threaded.get(), 1000, pose(0, 0, 0), 50.0, 0.1, initialReading, noise(0.05), 3));
+        GU::LocalisationWorkers workers(4);
+        ASSERT_EQ(workers.threads(), 4u);
+        for (int step = 1; step <= 20; step++) {
+            const gu_odometry_reading next = reading(step * 30, step, 0.02 * static_cast<double>(step));
+            gu_mcl_predict(mcl.get(), next);
+            workers.predict(*threaded, next);
+        }
+        ASSERT_EQ(threaded->last_reading.forward, 600);
+        for (size_t i = 0; i < 1000; i++) {
+            ASSERT_EQ(mcl->x[i], threaded->x[i]);
+            ASSERT_EQ(mcl->heading[i], threaded->heading[i]);
+        }
+    }
+
+    TEST_F(LocalisationTests, ResampleCopiesHeavyParticles) {
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 4, pose(0, 0, 0), 0.0, 0.0, initialReading, noise(0.0), 1));
+        for (size_t i = 0; i < 4; i++) {
+            mcl->x[i] = static_cast<double>(i);
+            mcl->weight[i] = i == 2 ? 5.0 : 0.0;
+        }
+        ASSERT_NEAR(gu_mcl_normalise(mcl.get()), 5.0, 0.000001);
+        ASSERT_NEAR(gu_mcl_effective_particles(mcl.get()), 1.0, 0.000001);
+        gu_mcl_resample(mcl.get());
+        for (size_t i = 0; i < 4; i++) {
+            ASSERT_NEAR(mcl->x[i], 2.0, 0.000001);
+            ASSERT_NEAR(mcl->weight[i], 0.25, 0.000001);
+        }
+        ASSERT_NEAR(gu_mcl_effective_particles(mcl.get()), 4.0, 0.000001);
+    }
+
+    TEST_F(LocalisationTests, SharpSightingsDoNotUnderflow) {
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 100, pose(0, 0, 0), 2000.0, 0.5, initialReading, noise(0.0), 3));
+        const gu_cartesian_coordinate landmark = {3000, 0};
+        const gu_relative_coordinate sighting = {0.0, 3000};
+        // Every particle's likelihood is far below the smallest double.
+        for (int i = 0; i < 5; i++) {
+            gu_mcl_weight_landmark(mcl.get(), landmark, sighting, 1.0);
+        }
+        ASSERT_NEAR(gu_mcl_normalise(mcl.get()), 0.01, 0.000001);
+        ASSERT_LT(gu_mcl_effective_particles(mcl.get()), 2.0);
+        for (size_t i = 0; i < 100; i++) {
+            ASSERT_EQ(mcl->logWeight[i], 0.0);
+        }
+    }
+
+    TEST_F(LocalisationTests, EstimateAveragesHeadingAcrossWrap) {
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 2, pose(0, 0, 0), 0.0, 0.0, initialReading, noise(0.0), 1));
+        mcl->x[0] = 100.0;
+        mcl->x[1] = 300.0;
+        mcl->heading[0] = M_PI - 0.1;
+        mcl->heading[1] = -M_PI + 0.1;
+        const gu_field_coordinate estimate = gu_mcl_estimate(mcl.get());
+        ASSERT_EQ(estimate.position.x, 200);
+        ASSERT_EQ(abs(estimate.heading), 180);
+    }
+
+    TEST_F(LocalisationTests, LandmarksLocaliseTheRobot) {
+        ASSERT_TRUE(gu_mcl_init(mcl.get(), 1000, pose(0, 0, 0), 500.0, 0.3, initialReading, noise(0.05), 5));
+        // The robot actually starts at (300, -200) facing 10 degrees and
+        // drives forward 50mm between frames.
+        double trueX = 300.0;
+        double trueY = -200.0;
+        const double trueHeading = 10.0 * M_PI / 180.0;
+        const gu_cartesian_coordinate landmarks[3] = {{3000, 0}, {0, 2000}, {-2500, -1500}};
+        for (int frame = 1; frame <= 10; frame++) {
+            for (size_t i = 0; i < 3; i++) {
+                const double dx = landmarks[i].x - trueX;
+                const double dy = landmarks[i].y - trueY;
+                const gu_cartesian_coordinate relative = {
+                    static_cast<millimetres_t>(round(cos(trueHeading) * dx + sin(trueHeading) * dy)),
+                    static_cast<millimetres_t>(round(cos(trueHeading) * dy - sin(trueHeading) * dx))
+                };
+                gu_mcl_weight_landmark(mcl.get(), landmarks[i], cartesian_coord_to_rr_coord(relative), 200.0);
+            }
+            gu_mcl_resample(mcl.get());
+            gu_mcl_predict(mcl.get(), reading(frame * 50, 0, 0.0));
+            trueX += 50.0 * cos(trueHeading);
+            trueY += 50.0 * sin(trueHeading);
+        }
+        const gu_field_coordinate estimate = gu_mcl_estimate(mcl.get());
+        ASSERT_NEAR(estimate.position.x, trueX, 100.0);
+        ASSERT_NEAR(estimate.position.y, trueY, 100.0);
+        ASSERT_NEAR(estimate.heading, 10, 5);
+    }
+
+} //namespace
@@ -0,0 +1,103 @@
+/*
+ * navigation_snapshot_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include "../NavigationSnapshot.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace CGTEST {
+
+    class NavigationSnapshotTests: public GUNavigationTests {};
+
+    static GU::NavigationSnapshot snapshot_at(const int step)
+    {
+        GU::NavigationSnapshot snapshot = {};
+        snapshot.status.my_position.position.x = step;
+        snapshot.status.my_position.position.y = -step;
+        snapshot.control.forward_control.target = static_cast<double>(step);
+        snapshot.control.turn_control.controllerOutput = static_cast<double>(step);
+        return snapshot;
+    }
+
+    TEST_F(NavigationSnapshotTests, PublishesStatusAndControl)
+    {
+        GU::NavigationPublisher publisher(snapshot_at(0));
+        ASSERT_EQ(publisher.version(), 0u);
+        const GU::NavigationSnapshot next = snapshot_at(5);
+        publisher.publish(next.status, next.control);
+        ASSERT_EQ(publisher.version(), 1u);
+        const GU::NavigationSnapshot snapshot = publisher.snapshot();
+        ASSERT_EQ(snapshot.status.my_position.position.x, 5);
+        ASSERT_NEAR(snapshot.control.forward_control.target, 5.0, 0.000001);
+    }
+
+    TEST_F(NavigationSnapshotTests, PublishingHalfKeepsTheOther)
+    {
+        GU::NavigationPublisher publisher(snapshot_at(1));
+        publisher.publish(snapshot_at(2).status);
+        publisher.publish(snapshot_at(3).control);
+        const GU::NavigationSnapshot snapshot = publisher.snapshot();
+        ASSERT_EQ(snapshot.status.my_position.position.x, 2);
+        ASSERT_NEAR(snapshot.control.forward_control.target, 3.0, 0.000001);
+        ASSERT_EQ(publisher.version(), 2u);
+    }
+
+    TEST_F(NavigationSnapshotTests, RefreshOnlyCopiesNewSnapshots)
+    {
+        GU::NavigationPublisher publisher(snapshot_at(0));
+        GU::NavigationSnapshot snapshot = snapshot_at(9);
+        uint64_t version = publisher.version();
+        ASSERT_FALSE(publisher.refresh(snapshot, version));
+        ASSERT_EQ(snapshot.status.my_position.position.x, 9);
+        publisher.publish(snapshot_at(4).status);
+        ASSERT_TRUE(publisher.refresh(snapshot, version));
+        ASSERT_EQ(version, 1u);
+        ASSERT_EQ(snapshot.status.my_position.position.x, 4);
+        ASSERT_FALSE(publisher.refresh(snapshot, version));
+    }
+
+    TEST_F(NavigationSnapshotTests, ConcurrentReadersSeeMatchingPairs)
+    {
+        GU::NavigationPublisher publisher(snapshot_at(0));
+        std::atomic<bool> done(false);
+        std::atomic<bool> mismatched(false);
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 3; i++) {
+            readers.push_back(std::thread([&]() {
+                GU::NavigationSnapshot snapshot = snapshot_at(0);
+                uint64_t version = 0;
+                int last = 0;
+                while (!done.load()) {
+                    if (!publisher.refresh(snapshot, version)) {
+                        continue;
+                    }
+                    const int step = snapshot.status.my_position.position.x;
+                    if (snapshot.status.my_position.position.y != -step
+                        || static_cast<int>(snapshot.control.forward_control.target) != step
+                        || static_cast<int>(snapshot.control.turn_control.controllerOutput) != step
+                        || step < last) {
+                        mismatched.store(true);
+                    }
+                    last = step;
+                }
+            }));
+        }
+        for (int step = 1; step <= 100000; step++) {
+            const GU::NavigationSnapshot next = snapshot_at(step);
+            publisher.publish(next.status, next.control);
+        }
+        done.store(true);
+        for (size_t i = 0; i < readers.size(); i++) {
+            readers[i].join();
+        }
+        ASSERT_FALSE(mismatched.load());
+        ASSERT_EQ(publisher.snapshot().status.my_position.position.x, 100000);
+    }
+
+} //namespace
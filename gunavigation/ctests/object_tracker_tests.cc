@@ -0,0 +1,132 @@
+/*
+ * object_tracker_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+#include <memory>
+
+namespace CGTEST {
+    
+    class ObjectTrackerTests: public GUNavigationTests {
+
+        protected:
+
+        std::unique_ptr<gu_object_tracker> tracker;
+
+        gu_field_coordinate origin;
+
+        virtual void SetUp() {
+            tracker.reset(new gu_object_tracker);
+            const gu_object_tracker_parameters parameters = {100.0, 400.0, 300, 3, false};
+            ASSERT_TRUE(gu_object_tracker_init(tracker.get(), parameters));
+            origin = pose(0, 0, 0);
+        }
+
+        static gu_field_coordinate pose(const millimetres_t x, const millimetres_t y, const degrees_t heading) {
+            gu_field_coordinate coordinate;
+            coordinate.position.x = x;
+            coordinate.position.y = y;
+            coordinate.heading = heading;
+            return coordinate;
+        }
+
+        static gu_sighting sightingAt(const millimetres_t x, const millimetres_t y, const uint64_t frame) {
+            const gu_cartesian_coordinate position = {x, y};
+            gu_sighting sighting;
+            sighting.location = cartesian_coord_to_rr_coord(position);
+            sighting.frameNumber = frame;
+            return sighting;
+        }
+
+    };
+
+    TEST_F(ObjectTrackerTests, RejectsInvalidParameters) {
+        const gu_object_tracker_parameters parameters = {100.0, 0.0, 300, 3, false};
+        ASSERT_FALSE(gu_object_tracker_init(tracker.get(), parameters));
+    }
+
+    TEST_F(ObjectTrackerTests, SightingsStartObjects) {
+        const gu_sighting sightings[2] = {sightingAt(1000, 0, 1), sightingAt(0, 2000, 1)};
+        ASSERT_EQ(gu_object_tracker_update(tracker.get(), origin, origin, sightings, 2, 1), 0u);
+        ASSERT_EQ(tracker->count, 2u);
+        ASSERT_NEAR(tracker->x[0], 1000.0, 1.0);
+        ASSERT_NEAR(tracker->y[1], 2000.0, 1.0);
+        ASSERT_EQ(tracker->ids[1], 1u);
+        const gu_relative_coordinate location = gu_object_tracker_location(tracker.get(), 1);
+        ASSERT_NEAR(location.direction, 90.0, 0.5);
+        ASSERT_NEAR(static_cast<double>(location.distance), 2000.0, 1.0);
+    }
+
+    TEST_F(ObjectTrackerTests, FollowsObjectWithinGate) {
+        for (uint64_t frame = 1; frame <= 10; frame++) {
+            const gu_sighting sighting = sightingAt(1000 + static_cast<millimetres_t>(frame) * 50, 0, frame);
+            gu_object_tracker_update(tracker.get(), origin, origin, &sighting, 1, frame);
+        }
+        ASSERT_EQ(tracker->count, 1u);
+        ASSERT_EQ(tracker->lastSeen[0], 10u);
+        ASSERT_GT(tracker->x[0], 1300.0);
+        ASSERT_LT(tracker->xVariance[0], 400.0);
+    }
+
+    TEST_F(ObjectTrackerTests, DistantSightingStartsNewObject) {
+        const gu_sighting first = sightingAt(1000, 0, 1);
+        gu_object_tracker_update(tracker.get(), origin, origin, &first, 1, 1);
+        const gu_sighting second = sightingAt(1500, 0, 2);
+        ASSERT_EQ(gu_object_tracker_update(tracker.get(), origin, origin, &second, 1, 2), 0u);
+        ASSERT_EQ(tracker->count, 2u);
+        ASSERT_NEAR(tracker->x[0], 1000.0, 1.0);
+    }
+
+    TEST_F(ObjectTrackerTests, PropagatesRobotMovement) {
+        const gu_sighting sighting = sightingAt(1000, 0, 1);
+        gu_object_tracker_update(tracker.get(), origin, origin, &sighting, 1, 1);
+        // Drive 400mm forward, then turn left on the spot by 90 degrees.
+        gu_object_tracker_update(tracker.get(), origin, pose(400, 0, 0), NULL, 0, 2);
+        ASSERT_NEAR(tracker->x[0], 600.0, 1.0);
+        ASSERT_NEAR(tracker->y[0], 0.0, 1.0);
+        gu_object_tracker_update(tracker.get(), pose(400, 0, 0), pose(400, 0, 90), NULL, 0, 3);
+        ASSERT_NEAR(tracker->x[0], 0.0, 1.0);
+        ASSERT_NEAR(tracker->y[0], -600.0, 1.0);
+        // The object is still associated at its moved position.
+        const gu_sighting moved = sightingAt(0, -620, 4);
+        ASSERT_EQ(gu_object_tracker_update(tracker.get(), pose(400, 0, 90), pose(400, 0, 90), &moved, 1, 4), 1u);
+        ASSERT_EQ(tracker->count, 1u);
+    }
+
+    TEST_F(ObjectTrackerTests, RetiresStaleObjects) {
+        const gu_sighting sightings[2] = {sightingAt(1000, 0, 1), sightingAt(-1000, 0, 1)};
+        gu_object_tracker_update(tracker.get(), origin, origin, sightings, 2, 1);
+        for (uint64_t frame = 2; frame <= 5; frame++) {
+            const gu_sighting sighting = sightingAt(-1000, 0, frame);
+            gu_object_tracker_update(tracker.get(), origin, origin, &sighting, 1, frame);
+        }
+        ASSERT_EQ(tracker->count, 1u);
+        ASSERT_EQ(tracker->ids[0], 1u);
+        ASSERT_EQ(gu_object_tracker_find(tracker.get(), 0), GU_OBJECT_TRACKER_NONE);
+        ASSERT_EQ(gu_object_tracker_find(tracker.get(), 1), 0u);
+    }
+
+    TEST_F(ObjectTrackerTests, KeepsObjectsWhenFramesGoBackwards) {
+        const gu_sighting sighting = sightingAt(1000, 0, 1);
+        gu_object_tracker_update(tracker.get(), origin, origin, &sighting, 1, 10);
+        gu_object_tracker_update(tracker.get(), origin, origin, NULL, 0, 9);
+        ASSERT_EQ(tracker->count, 1u);
+        ASSERT_EQ(tracker->ids[0], 0u);
+    }
+
+    TEST_F(ObjectTrackerTests, IgnoresSightingsBeyondCapacity) {
+        gu_sighting sightings[GU_OBJECT_TRACKER_CAPACITY + 8];
+        for (size_t i = 0; i < GU_OBJECT_TRACKER_CAPACITY + 8; i++) {
+            sightings[i] = sightingAt(static_cast<millimetres_t>(i) * 1000, 0, 1);
+        }
+        gu_object_tracker_update(tracker.get(), origin, origin, sightings, GU_OBJECT_TRACKER_CAPACITY + 8, 1);
+        ASSERT_EQ(tracker->count, static_cast<size_t>(GU_OBJECT_TRACKER_CAPACITY));
+    }
+
+} //namespace
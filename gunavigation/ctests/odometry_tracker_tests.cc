@@ -0,0 +1,152 @@
+/*
+ * odometry_tracker_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include "../OdometryTracker.hpp"
+
+#include <stdint.h>
+
+#include <thread>
+
+namespace CGTEST {
+
+    class OdometryTrackerTests: public GUNavigationTests {};
+
+    struct SeqlockPayload
+    {
+        uint64_t values[8];
+    };
+
+    static gu_odometry_reading reading_at(const int step)
+    {
+        const gu_odometry_reading reading = {step * 3, step, 0.001 * static_cast<double>(step), static_cast<uint8_t>(step / 500)};
+        return reading;
+    }
+
+    TEST_F(OdometryTrackerTests, QueueIsFirstInFirstOut)
+    {
+        GU::SPSCQueue<int, 4> queue;
+        int out[4] = {};
+        for (int round = 0; round < 3; round++) {
+            ASSERT_TRUE(queue.push(round * 10));
+            ASSERT_TRUE(queue.push(round * 10 + 1));
+            ASSERT_TRUE(queue.push(round * 10 + 2));
+            ASSERT_EQ(queue.size(), 3u);
+            ASSERT_EQ(queue.pop(out, 2), 2u);
+            ASSERT_EQ(out[0], round * 10);
+            ASSERT_EQ(out[1], round * 10 + 1);
+            ASSERT_EQ(queue.pop(out, 4), 1u);
+            ASSERT_EQ(out[0], round * 10 + 2);
+            ASSERT_EQ(queue.pop(out, 4), 0u);
+        }
+    }
+
+    TEST_F(OdometryTrackerTests, QueueRejectsWhenFull)
+    {
+        GU::SPSCQueue<int, 4> queue;
+        for (int i = 0; i < 4; i++) {
+            ASSERT_TRUE(queue.push(i));
+        }
+        ASSERT_FALSE(queue.push(4));
+        int out[1] = {};
+        ASSERT_EQ(queue.pop(out, 1), 1u);
+        ASSERT_EQ(out[0], 0);
+        ASSERT_TRUE(queue.push(4));
+    }
+
+    TEST_F(OdometryTrackerTests, SeqlockStoresAndLoads)
+    {
+        const gu_odometry_status initial = create_status(reading_at(0), gu_relative_coordinate());
+        GU::Seqlock<gu_odometry_status> lock(initial);
+        ASSERT_EQ(lock.version(), 0u);
+        gu_odometry_status status = initial;
+        status.my_position.position.x = 42;
+        status.target.distance = 7;
+        lock.store(status);
+        ASSERT_EQ(lock.version(), 1u);
+        const gu_odometry_status loaded = lock.load();
+        ASSERT_EQ(loaded.my_position.position.x, 42);
+        ASSERT_EQ(loaded.target.distance, 7u);
+    }
+
+    TEST_F(OdometryTrackerTests, SeqlockReadersNeverSeeTornValues)
+    {
+        SeqlockPayload payload = {};
+        GU::Seqlock<SeqlockPayload> lock(payload);
+        std::atomic<bool> done(false);
+        std::atomic<bool> torn(false);
+        std::thread reader([&]() {
+            while (!done.load()) {
+                const SeqlockPayload value = lock.load();
+                for (size_t i = 1; i < 8; i++) {
+                    if (value.values[i] != value.values[0]) {
+                        torn.store(true);
+                    }
+                }
+            }
+        });
+        for (uint64_t i = 1; i <= 200000; i++) {
+            for (size_t j = 0; j < 8; j++) {
+                payload.values[j] = i;
+            }
+            lock.store(payload);
+        }
+        done.store(true);
+        reader.join();
+        ASSERT_FALSE(torn.load());
+        ASSERT_EQ(lock.load().values[0], 200000u);
+    }
+
+    TEST_F(OdometryTrackerTests, UpdateMatchesTrack)
+    {
+        const gu_relative_coordinate target = {35.0, 2000};
+        gu_odometry_status expected = create_status(reading_at(0), target);
+        GU::OdometryTracker<16> tracker(expected);
+        ASSERT_EQ(tracker.update(), 0u);
+        for (int step = 1; step <= 10; step++) {
+            ASSERT_TRUE(tracker.push(reading_at(step)));
+            expected = track(reading_at(step), expected);
+        }
+        ASSERT_EQ(tracker.update(), 10u);
+        ASSERT_EQ(tracker.version(), 1u);
+        const gu_odometry_status status = tracker.status();
+        ASSERT_EQ(status.my_position.position.x, expected.my_position.position.x);
+        ASSERT_EQ(status.my_position.position.y, expected.my_position.position.y);
+        ASSERT_EQ(status.my_position.heading, expected.my_position.heading);
+        ASSERT_EQ(status.target.distance, expected.target.distance);
+        ASSERT_EQ(status.last_reading.forward, 30);
+    }
+
+    TEST_F(OdometryTrackerTests, ConcurrentProducerAndConsumer)
+    {
+        const int count = 20000;
+        const gu_relative_coordinate target = {35.0, 2000};
+        gu_odometry_status expected = create_status(reading_at(0), target);
+        for (int step = 1; step <= count; step++) {
+            expected = track(reading_at(step), expected);
+        }
+        GU::OdometryTracker<64> tracker(create_status(reading_at(0), target));
+        std::thread producer([&]() {
+            for (int step = 1; step <= count; step++) {
+                while (!tracker.push(reading_at(step))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        size_t applied = 0;
+        while (applied < static_cast<size_t>(count)) {
+            applied += tracker.update();
+        }
+        producer.join();
+        const gu_odometry_status status = tracker.status();
+        ASSERT_EQ(status.my_position.position.x, expected.my_position.position.x);
+        ASSERT_EQ(status.my_position.position.y, expected.my_position.position.y);
+        ASSERT_EQ(status.my_position.heading, expected.my_position.heading);
+        ASSERT_EQ(status.last_reading.forward, count * 3);
+    }
+
+} //namespace
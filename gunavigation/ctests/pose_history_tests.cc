@@ -0,0 +1,118 @@
+/*
+ * pose_history_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+namespace CGTEST {
+    
+    class PoseHistoryTests: public GUNavigationTests {
+
+        protected:
+
+        gu_pose_history_entry buffer[4];
+
+        gu_pose_history history;
+
+        virtual void SetUp() {
+            gu_pose_history_init(&history, buffer, 4);
+        }
+
+        static gu_odometry_status statusAt(const millimetres_t x, const millimetres_t y, const degrees_t heading) {
+            const gu_odometry_reading reading = {0, 0, 0.0, 0};
+            gu_odometry_status status = create_status_for_self(reading);
+            status.my_position.position.x = x;
+            status.my_position.position.y = y;
+            status.my_position.heading = heading;
+            return status;
+        }
+
+    };
+
+    TEST_F(PoseHistoryTests, EmptyHistoryHasNoPosition) {
+        gu_field_coordinate position;
+        ASSERT_FALSE(gu_pose_history_position_at(&history, 10, &position));
+    }
+
+    TEST_F(PoseHistoryTests, RejectsKeysThatDoNotIncrease) {
+        ASSERT_TRUE(gu_pose_history_push(&history, 10, statusAt(0, 0, 0)));
+        ASSERT_FALSE(gu_pose_history_push(&history, 10, statusAt(1, 1, 1)));
+        ASSERT_FALSE(gu_pose_history_push(&history, 5, statusAt(1, 1, 1)));
+        ASSERT_EQ(1u, history.count);
+    }
+
+    TEST_F(PoseHistoryTests, ExactAndInterpolatedLookups) {
+        ASSERT_TRUE(gu_pose_history_push(&history, 10, statusAt(0, 0, 0)));
+        ASSERT_TRUE(gu_pose_history_push(&history, 20, statusAt(100, -50, 10)));
+        ASSERT_TRUE(gu_pose_history_push(&history, 40, statusAt(300, 50, -10)));
+        gu_field_coordinate position;
+        ASSERT_TRUE(gu_pose_history_position_at(&history, 20, &position));
+        ASSERT_EQ(100, position.position.x);
+        ASSERT_EQ(-50, position.position.y);
+        ASSERT_EQ(10, position.heading);
+        ASSERT_TRUE(gu_pose_history_position_at(&history, 15, &position));
+        ASSERT_EQ(50, position.position.x);
+        ASSERT_EQ(-25, position.position.y);
+        ASSERT_EQ(5, position.heading);
+        ASSERT_TRUE(gu_pose_history_position_at(&history, 35, &position));
+        ASSERT_EQ(250, position.position.x);
+        ASSERT_EQ(25, position.position.y);
+        ASSERT_EQ(-5, position.heading);
+        ASSERT_FALSE(gu_pose_history_position_at(&history, 9, &position));
+        ASSERT_FALSE(gu_pose_history_position_at(&history, 41, &position));
+    }
+
+    TEST_F(PoseHistoryTests, InterpolatesHeadingAcrossWrap) {
+        ASSERT_TRUE(gu_pose_history_push(&history, 10, statusAt(0, 0, 170)));
+        ASSERT_TRUE(gu_pose_history_push(&history, 20, statusAt(0, 0, -170)));
+        ASSERT_TRUE(gu_pose_history_push(&history, 30, statusAt(0, 0, 350)));
+        gu_field_coordinate position;
+        ASSERT_TRUE(gu_pose_history_position_at(&history, 12, &position));
+        ASSERT_EQ(174, position.heading);
+        ASSERT_TRUE(gu_pose_history_position_at(&history, 15, &position));
+        ASSERT_EQ(-180, position.heading);
+        ASSERT_TRUE(gu_pose_history_position_at(&history, 18, &position));
+        ASSERT_EQ(-174, position.heading);
+        ASSERT_TRUE(gu_pose_history_position_at(&history, 25, &position));
+        ASSERT_EQ(-90, position.heading);
+    }
+
+    TEST_F(PoseHistoryTests, OverwritesOldestWhenFull) {
+        for (uint64_t frame = 1; frame <= 10; frame++) {
+            const millimetres_t x = static_cast<millimetres_t>(frame * 10);
+            ASSERT_TRUE(gu_pose_history_push(&history, frame, statusAt(x, 0, 0)));
+        }
+        ASSERT_EQ(4u, history.count);
+        ASSERT_EQ(7u, gu_pose_history_get(&history, 0)->key);
+        ASSERT_EQ(10u, gu_pose_history_get(&history, 3)->key);
+        gu_field_coordinate position;
+        ASSERT_FALSE(gu_pose_history_position_at(&history, 6, &position));
+        for (uint64_t frame = 7; frame <= 10; frame++) {
+            ASSERT_TRUE(gu_pose_history_position_at(&history, frame, &position));
+            ASSERT_EQ(static_cast<millimetres_t>(frame * 10), position.position.x);
+        }
+    }
+
+    TEST_F(PoseHistoryTests, ProjectsSightingsAgainstHistoricalPose) {
+        ASSERT_TRUE(gu_pose_history_push(&history, 100, statusAt(0, 0, 0)));
+        ASSERT_TRUE(gu_pose_history_push(&history, 102, statusAt(1000, 0, 90)));
+        const gu_relative_coordinate location = {0.0, 500};
+        const gu_sighting sighting = {location, 100};
+        gu_cartesian_coordinate coordinate;
+        ASSERT_TRUE(gu_pose_history_sighting_to_cartesian_coord(&history, sighting, &coordinate));
+        ASSERT_EQ(500, coordinate.x);
+        ASSERT_EQ(0, coordinate.y);
+        const gu_sighting later = {location, 102};
+        ASSERT_TRUE(gu_pose_history_sighting_to_cartesian_coord(&history, later, &coordinate));
+        ASSERT_EQ(1000, coordinate.x);
+        ASSERT_EQ(500, coordinate.y);
+        const gu_sighting missing = {location, 103};
+        ASSERT_FALSE(gu_pose_history_sighting_to_cartesian_coord(&history, missing, &coordinate));
+    }
+
+} //namespace
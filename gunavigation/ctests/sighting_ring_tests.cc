@@ -0,0 +1,82 @@
+/*
+ * sighting_ring_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+namespace CGTEST {
+    
+    class SightingRingTests: public GUNavigationTests {
+
+        protected:
+
+        gu_sighting buffer[6];
+
+        gu_sighting_ring ring;
+
+        virtual void SetUp() {
+            gu_sighting_ring_init(&ring, buffer, 6);
+        }
+
+        static gu_sighting sightingAt(const uint64_t frame, const millimetres_u distance) {
+            gu_sighting sighting;
+            sighting.location.direction = 0.0;
+            sighting.location.distance = distance;
+            sighting.frameNumber = frame;
+            return sighting;
+        }
+
+    };
+
+    TEST_F(SightingRingTests, EmptyRingHasNoFrames) {
+        gu_sighting_span spans[2];
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 0, UINT64_MAX, spans), 0u);
+    }
+
+    TEST_F(SightingRingTests, RejectsOlderFrames) {
+        ASSERT_TRUE(gu_sighting_ring_push(&ring, sightingAt(5, 1)));
+        ASSERT_TRUE(gu_sighting_ring_push(&ring, sightingAt(5, 2)));
+        ASSERT_FALSE(gu_sighting_ring_push(&ring, sightingAt(4, 3)));
+        ASSERT_EQ(ring.count, 2u);
+    }
+
+    TEST_F(SightingRingTests, FramesReferenceTheBuffer) {
+        ASSERT_TRUE(gu_sighting_ring_push(&ring, sightingAt(1, 10)));
+        ASSERT_TRUE(gu_sighting_ring_push(&ring, sightingAt(2, 20)));
+        ASSERT_TRUE(gu_sighting_ring_push(&ring, sightingAt(2, 21)));
+        ASSERT_TRUE(gu_sighting_ring_push(&ring, sightingAt(4, 40)));
+        gu_sighting_span spans[2];
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 2, 3, spans), 1u);
+        ASSERT_EQ(spans[0].sightings, &buffer[1]);
+        ASSERT_EQ(spans[0].count, 2u);
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 3, 3, spans), 0u);
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 4, 2, spans), 0u);
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 0, 100, spans), 1u);
+        ASSERT_EQ(spans[0].count, 4u);
+    }
+
+    TEST_F(SightingRingTests, FramesSplitAcrossTheEnd) {
+        for (uint64_t frame = 1; frame <= 9; frame++) {
+            ASSERT_TRUE(gu_sighting_ring_push(&ring, sightingAt(frame, static_cast<millimetres_u>(frame * 10))));
+        }
+        ASSERT_EQ(ring.count, 6u);
+        ASSERT_EQ(gu_sighting_ring_get(&ring, 0)->frameNumber, 4u);
+        gu_sighting_span spans[2];
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 5, 8, spans), 2u);
+        ASSERT_EQ(spans[0].sightings, &buffer[4]);
+        ASSERT_EQ(spans[0].count, 2u);
+        ASSERT_EQ(spans[0].sightings[0].frameNumber, 5u);
+        ASSERT_EQ(spans[1].sightings, &buffer[0]);
+        ASSERT_EQ(spans[1].count, 2u);
+        ASSERT_EQ(spans[1].sightings[1].location.distance, 80u);
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 0, 3, spans), 0u);
+        ASSERT_EQ(gu_sighting_ring_frames(&ring, 7, UINT64_MAX, spans), 1u);
+        ASSERT_EQ(spans[0].count, 3u);
+    }
+
+} //namespace
@@ -0,0 +1,163 @@
+/*
+ * sighting_shm_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+
+#include <signal.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace CGTEST {
+    
+    class SightingShmTests: public GUNavigationTests {
+
+        protected:
+
+        char path[64];
+
+        virtual void SetUp() {
+            snprintf(path, sizeof(path), "/tmp/gunavigation_sightings_%d", static_cast<int>(getpid()));
+        }
+
+        virtual void TearDown() {
+            unlink(path);
+        }
+
+        static gu_sighting sightingAt(const uint64_t frame) {
+            gu_sighting sighting;
+            sighting.location.direction = static_cast<double>(frame % 360);
+            sighting.location.distance = static_cast<millimetres_u>(frame);
+            sighting.frameNumber = frame;
+            return sighting;
+        }
+
+    };
+
+    TEST_F(SightingShmTests, OpenRejectsMissingAndMismatchedFiles) {
+        gu_sighting_shm reader = {};
+        ASSERT_FALSE(gu_sighting_shm_open(&reader, path));
+        gu_sighting_shm writer = {};
+        ASSERT_TRUE(gu_sighting_shm_create(&writer, path, 4));
+        writer.header->version = GU_SIGHTING_SHM_VERSION + 1;
+        ASSERT_FALSE(gu_sighting_shm_open(&reader, path));
+        writer.header->version = GU_SIGHTING_SHM_VERSION;
+        ASSERT_TRUE(gu_sighting_shm_open(&reader, path));
+        ASSERT_EQ(reader.capacity, 4u);
+        gu_sighting_shm_close(&reader);
+        gu_sighting_shm_close(&writer);
+    }
+
+    TEST_F(SightingShmTests, ReaderSeesSightingsInPlace) {
+        gu_sighting_shm writer = {};
+        gu_sighting_shm reader = {};
+        ASSERT_TRUE(gu_sighting_shm_create(&writer, path, 4));
+        ASSERT_TRUE(gu_sighting_shm_open(&reader, path));
+        gu_sighting_span spans[2];
+        ASSERT_EQ(gu_sighting_shm_peek(&reader, spans), 0u);
+        for (uint64_t frame = 1; frame <= 3; frame++) {
+            gu_sighting *slot = gu_sighting_shm_reserve(&writer, static_cast<size_t>(frame - 1));
+            ASSERT_NE(slot, nullptr);
+            *slot = sightingAt(frame);
+        }
+        ASSERT_EQ(gu_sighting_shm_peek(&reader, spans), 0u);
+        gu_sighting_shm_commit(&writer, 3);
+        ASSERT_EQ(gu_sighting_shm_peek(&reader, spans), 1u);
+        ASSERT_EQ(spans[0].count, 3u);
+        ASSERT_EQ(spans[0].sightings[2].frameNumber, 3u);
+        ASSERT_TRUE(gu_sighting_shm_write(&writer, sightingAt(4)));
+        ASSERT_FALSE(gu_sighting_shm_write(&writer, sightingAt(5)));
+        gu_sighting_shm_release(&reader, 2);
+        ASSERT_TRUE(gu_sighting_shm_write(&writer, sightingAt(5)));
+        ASSERT_TRUE(gu_sighting_shm_write(&writer, sightingAt(6)));
+        ASSERT_EQ(gu_sighting_shm_peek(&reader, spans), 2u);
+        ASSERT_EQ(spans[0].count, 2u);
+        ASSERT_EQ(spans[0].sightings[0].frameNumber, 3u);
+        ASSERT_EQ(spans[1].count, 2u);
+        ASSERT_EQ(spans[1].sightings[1].frameNumber, 6u);
+        gu_sighting_shm_close(&reader);
+        gu_sighting_shm_close(&writer);
+    }
+
+    TEST_F(SightingShmTests, PeekIgnoresCorruptedCounts) {
+        gu_sighting_shm writer = {};
+        gu_sighting_shm reader = {};
+        ASSERT_TRUE(gu_sighting_shm_create(&writer, path, 4));
+        ASSERT_TRUE(gu_sighting_shm_open(&reader, path));
+        gu_sighting_span spans[2];
+        writer.header->read = 10;
+        writer.header->written = 15;
+        ASSERT_EQ(gu_sighting_shm_peek(&reader, spans), 0u);
+        writer.header->written = 5;
+        ASSERT_EQ(gu_sighting_shm_peek(&reader, spans), 0u);
+        writer.header->written = 14;
+        ASSERT_EQ(gu_sighting_shm_peek(&reader, spans), 2u);
+        ASSERT_EQ(spans[0].count + spans[1].count, 4u);
+        gu_sighting_shm_close(&reader);
+        gu_sighting_shm_close(&writer);
+    }
+
+    TEST_F(SightingShmTests, ProducerAndConsumerProcesses) {
+        const uint64_t count = 100000;
+        gu_sighting_shm writer = {};
+        ASSERT_TRUE(gu_sighting_shm_create(&writer, path, 256));
+        const pid_t producer = fork();
+        ASSERT_GE(producer, 0);
+        if (producer == 0) {
+            for (uint64_t frame = 1; frame <= count; frame++) {
+                while (!gu_sighting_shm_write(&writer, sightingAt(frame))) {
+                    usleep(0);
+                }
+            }
+            _exit(0);
+        }
+        gu_sighting_shm_close(&writer);
+        gu_sighting_shm reader = {};
+        ASSERT_TRUE(gu_sighting_shm_open(&reader, path));
+        uint64_t expected = 1;
+        bool ordered = true;
+        bool exited = false;
+        int status = 0;
+        const time_t deadline = time(NULL) + 60;
+        while (expected <= count) {
+            gu_sighting_span spans[2];
+            const size_t spanCount = gu_sighting_shm_peek(&reader, spans);
+            if (spanCount == 0) {
+                // Stop if the producer exited without writing everything,
+                // once its last sightings have been drained, or hung.
+                if (exited || time(NULL) > deadline) {
+                    break;
+                }
+                exited = waitpid(producer, &status, WNOHANG) == producer;
+                continue;
+            }
+            size_t total = 0;
+            for (size_t i = 0; i < spanCount; i++) {
+                for (size_t j = 0; j < spans[i].count; j++) {
+                    const gu_sighting sighting = spans[i].sightings[j];
+                    ordered = ordered && sighting.frameNumber == expected && sighting.location.distance == static_cast<millimetres_u>(expected);
+                    expected++;
+                }
+                total += spans[i].count;
+            }
+            gu_sighting_shm_release(&reader, total);
+        }
+        if (!exited) {
+            if (expected <= count) {
+                kill(producer, SIGKILL);
+            }
+            ASSERT_EQ(waitpid(producer, &status, 0), producer);
+        }
+        ASSERT_GT(expected, count) << "The producer stopped after " << expected - 1 << " sightings.";
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(WEXITSTATUS(status), 0);
+        ASSERT_TRUE(ordered);
+        gu_sighting_shm_close(&reader);
+    }
+
+} //namespace
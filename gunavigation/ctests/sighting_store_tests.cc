@@ -0,0 +1,151 @@
+/*
+ * sighting_store_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+#include <climits>
+#include <cstdint>
+
+namespace CGTEST {
+    
+    class SightingStoreTests: public GUNavigationTests {
+
+        protected:
+
+        gu_sighting_store_entry entries[8];
+
+        gu_sighting_store_bucket buckets[16];
+
+        gu_sighting_store store;
+
+        virtual void SetUp() {
+            ASSERT_TRUE(gu_sighting_store_init(&store, entries, 8, buckets, 16, 500));
+        }
+
+        static gu_sighting sightingAt(const degrees_d direction, const millimetres_u distance) {
+            gu_sighting sighting;
+            sighting.location.direction = direction;
+            sighting.location.distance = distance;
+            sighting.frameNumber = 1;
+            return sighting;
+        }
+
+        static gu_cartesian_coordinate point(const millimetres_t x, const millimetres_t y) {
+            gu_cartesian_coordinate coordinate;
+            coordinate.x = x;
+            coordinate.y = y;
+            return coordinate;
+        }
+
+    };
+
+    TEST_F(SightingStoreTests, RejectsInvalidConfiguration) {
+        ASSERT_FALSE(gu_sighting_store_init(&store, entries, 8, buckets, 12, 500));
+        ASSERT_FALSE(gu_sighting_store_init(&store, entries, 8, buckets, 16, 0));
+    }
+
+    TEST_F(SightingStoreTests, EmptyStoreHasNoNearest) {
+        ASSERT_EQ(gu_sighting_store_nearest(&store, point(0, 0), 1000), nullptr);
+    }
+
+    TEST_F(SightingStoreTests, FindsNearestWithinDistance) {
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(0.0, 1000)));
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(90.0, 1000)));
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(180.0, 1000)));
+        const gu_sighting_store_entry *entry = gu_sighting_store_nearest(&store, point(100, 1100), 300);
+        ASSERT_NE(entry, nullptr);
+        ASSERT_EQ(entry->position.x, 0);
+        ASSERT_EQ(entry->position.y, 1000);
+        ASSERT_EQ(gu_sighting_store_nearest(&store, point(0, 0), 300), nullptr);
+    }
+
+    TEST_F(SightingStoreTests, SearchesNeighbouringCells) {
+        // Either side of the cell boundary at x = -500.
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(180.0, 510)));
+        const gu_sighting_store_entry *entry = gu_sighting_store_nearest(&store, point(-490, 0), 100);
+        ASSERT_NE(entry, nullptr);
+        ASSERT_EQ(entry->position.x, -510);
+        ASSERT_NE(gu_sighting_store_nearest(&store, point(-490, 0), 1500), nullptr);
+    }
+
+    TEST_F(SightingStoreTests, ClearEmptiesStore) {
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(0.0, 1000)));
+        gu_sighting_store_clear(&store);
+        ASSERT_EQ(store.count, 0u);
+        ASSERT_EQ(gu_sighting_store_nearest(&store, point(1000, 0), 100), nullptr);
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(0.0, 2000)));
+        const gu_sighting_store_entry *entry = gu_sighting_store_nearest(&store, point(1900, 0), 200);
+        ASSERT_NE(entry, nullptr);
+        ASSERT_EQ(entry->position.x, 2000);
+        ASSERT_EQ(entry->next, GU_SIGHTING_STORE_NONE);
+    }
+
+    TEST_F(SightingStoreTests, FullStoreRejectsSightings) {
+        for (int i = 0; i < 8; i++) {
+            ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(0.0, 1000)));
+        }
+        ASSERT_FALSE(gu_sighting_store_insert(&store, sightingAt(0.0, 1000)));
+    }
+
+    TEST_F(SightingStoreTests, AssociatesEachSightingOnce) {
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(0.0, 1000)));
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(0.0, 1200)));
+        const gu_cartesian_coordinate tracks[3] = {point(1000, 50), point(1050, 0), point(-3000, 0)};
+        size_t assignments[3];
+        ASSERT_EQ(gu_sighting_store_associate(&store, tracks, 3, 300, assignments), 2u);
+        ASSERT_EQ(assignments[0], 0u);
+        ASSERT_EQ(assignments[1], 1u);
+        ASSERT_EQ(assignments[2], GU_SIGHTING_STORE_NONE);
+        ASSERT_TRUE(store.entries[0].claimed);
+        ASSERT_EQ(gu_sighting_store_nearest(&store, point(1000, 0), 300), nullptr);
+    }
+
+    TEST_F(SightingStoreTests, UnboundedDistanceDoesNotOverflow) {
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(0.0, 1000)));
+        const gu_sighting_store_entry *entry = gu_sighting_store_nearest(&store, point(INT_MAX, INT_MIN), UINT_MAX);
+        ASSERT_NE(entry, nullptr);
+        ASSERT_EQ(entry->position.x, 1000);
+        ASSERT_NE(gu_sighting_store_nearest(&store, point(INT_MIN, INT_MAX), UINT_MAX), nullptr);
+        gu_sighting_store_clear(&store);
+        // Further than any millimetres_u, so the squared distance must not wrap.
+        ASSERT_TRUE(gu_sighting_store_insert(&store, sightingAt(45.0, 3000000000u)));
+        ASSERT_EQ(gu_sighting_store_nearest(&store, point(INT_MIN, INT_MIN), UINT_MAX), nullptr);
+    }
+
+    TEST_F(SightingStoreTests, CellSearchMatchesLinearSearch) {
+        gu_sighting_store_entry manyEntries[64];
+        gu_sighting_store_bucket manyBuckets[16];
+        gu_sighting_store many;
+        ASSERT_TRUE(gu_sighting_store_init(&many, manyEntries, 64, manyBuckets, 16, 500));
+        // Every sighting is inserted twice, so ties must go to the first.
+        for (int i = 0; i < 64; i++) {
+            ASSERT_TRUE(gu_sighting_store_insert(&many, sightingAt((i / 2 * 37) % 360, 200 + (i / 2 * 211) % 3000)));
+        }
+        const millimetres_u distances[] = {0, 250, 500, 1000, 1500, 1501, 5000};
+        for (millimetres_t x = -3000; x <= 3000; x += 230) {
+            for (millimetres_t y = -3000; y <= 3000; y += 170) {
+                for (size_t d = 0; d < sizeof(distances) / sizeof(distances[0]); d++) {
+                    const uint64_t limit = static_cast<uint64_t>(distances[d]) * distances[d];
+                    const gu_sighting_store_entry *expected = nullptr;
+                    uint64_t best = limit;
+                    for (size_t i = 0; i < many.count; i++) {
+                        const int64_t dx = static_cast<int64_t>(manyEntries[i].position.x) - x;
+                        const int64_t dy = static_cast<int64_t>(manyEntries[i].position.y) - y;
+                        const uint64_t distance = static_cast<uint64_t>(dx * dx + dy * dy);
+                        if (distance < best || (expected == nullptr && distance == best)) {
+                            best = distance;
+                            expected = &manyEntries[i];
+                        }
+                    }
+                    ASSERT_EQ(gu_sighting_store_nearest(&many, point(x, y), distances[d]), expected) << x << ", " << y << ", " << distances[d];
+                }
+            }
+        }
+    }
+
+} //namespace
@@ -178,16 +178,287 @@ namespace CGTEST {
 
     }
 
-    
+    static void compareStatusExactly(const gu_odometry_status expected, const gu_odometry_status actual)
+    {
+        ASSERT_EQ(expected.my_position.position.x, actual.my_position.position.x);
+        ASSERT_EQ(expected.my_position.position.y, actual.my_position.position.y);
+        ASSERT_EQ(expected.my_position.heading, actual.my_position.heading);
+        ASSERT_EQ(expected.target.distance, actual.target.distance);
+        ASSERT_EQ(expected.target.direction, actual.target.direction);
+        ASSERT_EQ(expected.last_reading.forward, actual.last_reading.forward);
+        ASSERT_EQ(expected.last_reading.left, actual.last_reading.left);
+        ASSERT_EQ(expected.last_reading.turn, actual.last_reading.turn);
+        ASSERT_EQ(expected.last_reading.resetCounter, actual.last_reading.resetCounter);
+    }
 
+    TEST_F(TrackingTests, TrackBatchMatchesTrackCartesian)
+    {
+        const size_t count = 200;
+        gu_odometry_reading readings[count];
+        gu_odometry_status actual[count];
+        uint8_t resetCounter = 254;
+        millimetres_t forward = 0;
+        millimetres_t left = 0;
+        double turn = 0.0;
+        for (size_t i = 0; i < count; i++) {
+            if (i % 37 == 36) {
+                // Counter rollovers, including the uint8_t wraparound from 255 to 0.
+                resetCounter = static_cast<uint8_t>(resetCounter + 1);
+                forward = 0;
+                left = 0;
+                turn = 0.0;
+            }
+            forward += static_cast<millimetres_t>(10 + i % 13);
+            left += static_cast<millimetres_t>(static_cast<int>(i % 7) - 3);
+            turn += 0.02 * sin(static_cast<double>(i) * 0.05);
+            const gu_odometry_reading reading = {forward, left, turn, resetCounter};
+            readings[i] = reading;
+        }
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 253};
+        const gu_relative_coordinate target = {35.0, 2000};
+        gu_odometry_status initial = create_status(initialReading, target);
+        initial.my_position.heading = 20;
+        track_batch(readings, count, initial, actual);
+        gu_odometry_status polar = initial;
+        gu_cartesian_odometry_status expected = create_cartesian_status(initial);
+        for (size_t i = 0; i < count; i++) {
+            const gu_odometry_reading last = expected.last_reading;
+            const bool reset = readings[i].resetCounter != last.resetCounter;
+            const double stepTurn = reset ? readings[i].turn : readings[i].turn - last.turn;
+            const gu_cartesian_coordinate difference = calculate_difference_fast(
+                reset ? readings[i].forward : readings[i].forward - last.forward,
+                reset ? readings[i].left : readings[i].left - last.left,
+                stepTurn,
+                deg_d_to_rad_d(rad_d_to_d(expected.my_position.heading))
+            );
+            expected.my_position.position.x += difference.x;
+            expected.my_position.position.y += difference.y;
+            expected.my_position.heading += rad_d_to_deg_t(stepTurn);
+            expected.last_reading = readings[i];
+            compareStatusExactly(cartesian_status_to_status(expected), actual[i]);
+            // Without the polar round trips the batch stays close to track().
+            polar = track(readings[i], polar);
+            ASSERT_EQ(polar.my_position.heading, actual[i].my_position.heading);
+            ASSERT_LE(abs(polar.my_position.position.x - actual[i].my_position.position.x), 20);
+            ASSERT_LE(abs(polar.my_position.position.y - actual[i].my_position.position.y), 20);
+        }
+    }
 
+    TEST_F(TrackingTests, TrackBatchReducesLargeTurns)
+    {
+        // Turns beyond GU_SINCOS_FAST_RANGE, which the fast path cannot
+        // evaluate directly.
+        const size_t count = 4;
+        const double turns[count] = {2.0e5, -3.0e5 + 0.5, 1.0e6, 1.0e6 + 0.25};
+        gu_odometry_reading readings[count];
+        gu_odometry_status actual[count];
+        for (size_t i = 0; i < count; i++) {
+            const gu_odometry_reading reading = {static_cast<millimetres_t>(1000 * (i + 1)), 0, turns[i], 0};
+            readings[i] = reading;
+        }
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_relative_coordinate target = {0.0, 1000};
+        const gu_odometry_status initial = create_status(initialReading, target);
+        track_batch(readings, count, initial, actual);
+        gu_cartesian_odometry_status expected = create_cartesian_status(initial);
+        for (size_t i = 0; i < count; i++) {
+            expected = track_cartesian(readings[i], expected);
+            ASSERT_EQ(expected.my_position.heading, actual[i].my_position.heading);
+            ASSERT_LE(abs(expected.my_position.position.x - actual[i].my_position.position.x), 1);
+            ASSERT_LE(abs(expected.my_position.position.y - actual[i].my_position.position.y), 1);
+        }
+    }
 
+    TEST_F(TrackingTests, TrackBatchSpansChunks)
+    {
+        const size_t count = 150;
+        gu_odometry_reading readings[count];
+        gu_odometry_status batch[count];
+        gu_odometry_status split[count];
+        for (size_t i = 0; i < count; i++) {
+            const gu_odometry_reading reading = {static_cast<millimetres_t>(i * 15), static_cast<millimetres_t>(i), 0.01 * static_cast<double>(i), 0};
+            readings[i] = reading;
+        }
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_relative_coordinate target = {-60.0, 1500};
+        const gu_odometry_status initial = create_status(initialReading, target);
+        track_batch(readings, count, initial, batch);
+        track_batch(readings, 1, initial, split);
+        track_batch(&readings[1], count - 1, split[0], &split[1]);
+        ASSERT_EQ(batch[count - 1].my_position.position.x, split[count - 1].my_position.position.x);
+        ASSERT_EQ(batch[count - 1].my_position.position.y, split[count - 1].my_position.position.y);
+        ASSERT_EQ(batch[count - 1].my_position.heading, split[count - 1].my_position.heading);
+    }
+
+    TEST_F(TrackingTests, TrackMultiMatchesTrack)
+    {
+        const size_t count = 5;
+        degrees_d directions[count] = {0.0, 35.0, -90.0, 170.0, -45.5};
+        millimetres_u distances[count] = {0, 2000, 750, 4500, 1200};
+        millimetres_d x[count];
+        millimetres_d y[count];
+        degrees_d actualDirections[count];
+        millimetres_u actualDistances[count];
+        const gu_relative_coordinates targets = {directions, distances};
+        const gu_relative_cartesian_coordinates storage = {x, y};
+        const gu_relative_coordinates actualTargets = {actualDirections, actualDistances};
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        gu_odometry_status expected[count];
+        gu_cartesian_coordinate fieldTargets[count];
+        for (size_t i = 0; i < count; i++) {
+            const gu_relative_coordinate target = {directions[i], distances[i]};
+            expected[i] = create_status(initialReading, target);
+            fieldTargets[i] = rr_coord_to_cartesian_coord_from_field(target, expected[i].my_position);
+        }
+        gu_multi_odometry_status actual = create_multi_status(initialReading, targets, storage, count);
+        for (int step = 1; step <= 50; step++) {
+            const uint8_t resetCounter = static_cast<uint8_t>(step / 20);
+            const gu_odometry_reading reading = {step * 12, step * -3, 0.015 * static_cast<double>(step), resetCounter};
+            track_multi(reading, &actual);
+            multi_status_targets(&actual, actualTargets);
+            for (size_t i = 0; i < count; i++) {
+                expected[i] = track(reading, expected[i]);
+                ASSERT_EQ(expected[i].my_position.position.x, actual.my_position.position.x);
+                ASSERT_EQ(expected[i].my_position.position.y, actual.my_position.position.y);
+                ASSERT_EQ(expected[i].my_position.heading, actual.my_position.heading);
+                // The targets stay where they are in the field.
+                const gu_relative_coordinate fixed = field_coord_to_rr_coord_to_target(actual.my_position, fieldTargets[i]);
+                ASSERT_NEAR(static_cast<double>(actualDistances[i]), static_cast<double>(fixed.distance), 2.0);
+                if (fixed.distance > 0) {
+                    ASSERT_NEAR(remainder(actualDirections[i] - fixed.direction, 360.0), 0.0, 0.1);
+                }
+            }
+        }
+        ASSERT_EQ(directions[1], 35.0);
+        ASSERT_EQ(distances[1], 2000u);
+    }
 
+    TEST_F(TrackingTests, UpdateTargetsFromMovementMatchesSingleTarget)
+    {
+        const gu_field_coordinate oldPosition = {{100, -50}, 30};
+        const gu_field_coordinate newPosition = {{400, 250}, -75};
+        const gu_relative_coordinate target = {60.0, 3000};
+        millimetres_d x[1];
+        millimetres_d y[1];
+        degrees_d direction[1];
+        millimetres_u distance[1];
+        const gu_relative_coordinates polar = {&direction[0], &distance[0]};
+        const gu_relative_cartesian_coordinates storage = {x, y};
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        direction[0] = target.direction;
+        distance[0] = target.distance;
+        gu_multi_odometry_status status = create_multi_status(initialReading, polar, storage, 1);
+        update_targets_from_movement(oldPosition, newPosition, status.targets, 1);
+        multi_status_targets(&status, polar);
+        const gu_relative_coordinate expected = update_target_from_movement(oldPosition, newPosition, target);
+        ASSERT_NEAR(static_cast<double>(distance[0]), static_cast<double>(expected.distance), 1.0);
+        ASSERT_NEAR(remainder(direction[0] - expected.direction, 360.0), 0.0, 0.1);
+    }
 
+    TEST_F(TrackingTests, CartesianStatusRoundTrip)
+    {
+        const gu_odometry_reading initialReading = {10, -4, 0.5, 7};
+        const gu_relative_coordinate target = {35.0, 2000};
+        gu_odometry_status status = create_status(initialReading, target);
+        status.my_position.position.x = 120;
+        status.my_position.position.y = -340;
+        status.my_position.heading = 30;
+        const gu_odometry_status view = cartesian_status_to_status(create_cartesian_status(status));
+        ASSERT_EQ(view.my_position.position.x, 120);
+        ASSERT_EQ(view.my_position.position.y, -340);
+        ASSERT_EQ(view.my_position.heading, 30);
+        ASSERT_NEAR(view.target.direction, 35.0, 1.0);
+        ASSERT_NEAR(static_cast<double>(view.target.distance), 2000.0, 1.0);
+        ASSERT_EQ(view.last_reading.resetCounter, 7);
+    }
 
+    TEST_F(TrackingTests, TrackCartesianMatchesTrack)
+    {
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_relative_coordinate target = {35.0, 2000};
+        gu_odometry_status status = create_status(initialReading, target);
+        gu_cartesian_odometry_status cartesian = create_cartesian_status(status);
+        for (int step = 1; step <= 100; step++) {
+            const gu_odometry_reading reading = {step * 10, step * 2, deg_d_to_rad_d(static_cast<double>(step)), 0};
+            status = track(reading, status);
+            cartesian = track_cartesian(reading, cartesian);
+            ASSERT_EQ(cartesian.my_position.heading, status.my_position.heading);
+            ASSERT_LE(abs(cartesian.my_position.position.x - status.my_position.position.x), step);
+            ASSERT_LE(abs(cartesian.my_position.position.y - status.my_position.position.y), step);
+        }
+        const gu_relative_coordinate view = cartesian_status_target(cartesian);
+        ASSERT_NEAR(static_cast<double>(view.distance), static_cast<double>(status.target.distance), 100.0);
+    }
 
+    TEST_F(TrackingTests, TrackCartesianKeepsTargetFixed)
+    {
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_relative_coordinate target = {0.0, 1000};
+        gu_cartesian_odometry_status status = create_cartesian_status(create_status(initialReading, target));
+        const gu_odometry_reading forward = {400, 0, 0.0, 0};
+        status = track_cartesian(forward, status);
+        ASSERT_EQ(status.target.x, 1000);
+        ASSERT_EQ(status.target.y, 0);
+        const gu_relative_coordinate view = cartesian_status_target(status);
+        ASSERT_EQ(view.distance, 600u);
+        ASSERT_NEAR(view.direction, 0.0, 0.000001);
+    }
 
+    TEST_F(TrackingTests, PreciseStatusRoundTrip)
+    {
+        const gu_odometry_reading initialReading = {10, -4, 0.5, 7};
+        const gu_relative_coordinate target = {35.0, 2000};
+        gu_odometry_status status = create_status(initialReading, target);
+        status.my_position.position.x = 120;
+        status.my_position.position.y = -340;
+        status.my_position.heading = 30;
+        const gu_odometry_status view = precise_status_to_status(create_precise_status(status));
+        ASSERT_EQ(view.my_position.position.x, 120);
+        ASSERT_EQ(view.my_position.position.y, -340);
+        ASSERT_EQ(view.my_position.heading, 30);
+        ASSERT_NEAR(view.target.direction, 35.0, 0.000001);
+        ASSERT_EQ(view.target.distance, 2000u);
+        ASSERT_EQ(view.last_reading.resetCounter, 7);
+    }
 
+    TEST_F(TrackingTests, PreciseStatusWrapsHeading)
+    {
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_relative_coordinate target = {0.0, 0};
+        gu_precise_odometry_status status = create_precise_status(create_status(initialReading, target));
+        const gu_odometry_reading reading = {0, 0, deg_d_to_rad_d(370.0), 0};
+        status = track_precise(reading, status);
+        ASSERT_NEAR(status.heading, deg_d_to_rad_d(370.0), 0.000001);
+        ASSERT_EQ(precise_status_position(status).heading, 10);
+    }
 
+    TEST_F(TrackingTests, TrackPreciseReducesDrift)
+    {
+        // Turning by less than half a degree per reading is lost entirely by
+        // the whole degree heading of track().
+        const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+        const gu_relative_coordinate target = {35.0, 2000};
+        gu_odometry_status status = create_status(initialReading, target);
+        gu_precise_odometry_status precise = create_precise_status(status);
+        long double x = 0.0L;
+        long double y = 0.0L;
+        long double heading = 0.0L;
+        for (int step = 1; step <= 1000; step++) {
+            const gu_odometry_reading reading = {step * 7, step, 0.004 * static_cast<double>(step), 0};
+            status = track(reading, status);
+            precise = track_precise(reading, precise);
+            heading += 0.004L;
+            x += 7.0L * cosl(heading) - sinl(heading);
+            y += 7.0L * sinl(heading) + cosl(heading);
+        }
+        const double trackError = static_cast<double>(hypotl(static_cast<long double>(status.my_position.position.x) - x, static_cast<long double>(status.my_position.position.y) - y));
+        const double preciseError = static_cast<double>(hypotl(static_cast<long double>(precise.x) - x, static_cast<long double>(precise.y) - y));
+        ASSERT_LT(preciseError, 0.000001);
+        ASSERT_GT(trackError, 100.0);
+        const gu_field_coordinate position = precise_status_position(precise);
+        ASSERT_EQ(position.position.x, static_cast<millimetres_t>(roundl(x)));
+        ASSERT_EQ(position.position.y, static_cast<millimetres_t>(roundl(y)));
+        ASSERT_EQ(position.heading, static_cast<degrees_t>(roundl(heading * 180.0L / static_cast<long double>(M_PI))) - 360);
+    }
 
 } //namespace
@@ -0,0 +1,91 @@
+/*
+ * trigonometry_tests.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "gunavigation_tests.hpp"
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+namespace CGTEST {
+    
+    class TrigonometryTests: public GUNavigationTests {};
+
+    TEST_F(TrigonometryTests, SinCosMatchesLibrary) {
+        double sine;
+        double cosine;
+        gu_sincos(0.3, &sine, &cosine);
+        ASSERT_EQ(sin(0.3), sine);
+        ASSERT_EQ(cos(0.3), cosine);
+    }
+
+    TEST_F(TrigonometryTests, FastSinCosWithinBoundNearZero) {
+        for (int i = -100000; i <= 100000; i++) {
+            const double angle = static_cast<double>(i) * 0.0001;
+            double sine;
+            double cosine;
+            gu_sincos_fast(angle, &sine, &cosine);
+            ASSERT_NEAR(sin(angle), sine, GU_SINCOS_FAST_MAX_ERROR);
+            ASSERT_NEAR(cos(angle), cosine, GU_SINCOS_FAST_MAX_ERROR);
+        }
+    }
+
+    TEST_F(TrigonometryTests, FastSinCosWithinBoundOverRange) {
+        for (int i = -100000; i <= 100000; i++) {
+            const double angle = static_cast<double>(i) * (GU_SINCOS_FAST_RANGE / 100000.0) + 0.123;
+            double sine;
+            double cosine;
+            gu_sincos_fast(angle, &sine, &cosine);
+            ASSERT_NEAR(sin(angle), sine, GU_SINCOS_FAST_MAX_ERROR);
+            ASSERT_NEAR(cos(angle), cosine, GU_SINCOS_FAST_MAX_ERROR);
+        }
+    }
+
+    TEST_F(TrigonometryTests, FastReduceBringsAnglesIntoRange) {
+        ASSERT_DOUBLE_EQ(gu_sincos_fast_reduce(0.3), 0.3);
+        ASSERT_DOUBLE_EQ(gu_sincos_fast_reduce(-GU_SINCOS_FAST_RANGE), -GU_SINCOS_FAST_RANGE);
+        const double angles[] = {GU_SINCOS_FAST_RANGE * 1.5, -4.0e9, 1.0e15};
+        for (size_t i = 0; i < sizeof(angles) / sizeof(angles[0]); i++) {
+            const double reduced = gu_sincos_fast_reduce(angles[i]);
+            ASSERT_LE(fabs(reduced), M_PI);
+            double sine;
+            double cosine;
+            gu_sincos_fast(reduced, &sine, &cosine);
+            ASSERT_NEAR(sin(angles[i]), sine, 1.0e-6);
+            ASSERT_NEAR(cos(angles[i]), cosine, 1.0e-6);
+        }
+        ASSERT_DOUBLE_EQ(gu_sincos_fast_reduce(NAN), 0.0);
+        ASSERT_DOUBLE_EQ(gu_sincos_fast_reduce(INFINITY), 0.0);
+        ASSERT_DOUBLE_EQ(gu_sincos_fast_reduce(-INFINITY), 0.0);
+    }
+
+    TEST_F(TrigonometryTests, FastSinCosQuadrants) {
+        const double halfPi = M_PI / 2.0;
+        const double expectedSine[4] = {0.0, 1.0, 0.0, -1.0};
+        const double expectedCosine[4] = {1.0, 0.0, -1.0, 0.0};
+        for (int i = -8; i <= 8; i++) {
+            double sine;
+            double cosine;
+            gu_sincos_fast(halfPi * static_cast<double>(i), &sine, &cosine);
+            ASSERT_NEAR(expectedSine[(i + 8) % 4], sine, GU_SINCOS_FAST_MAX_ERROR);
+            ASSERT_NEAR(expectedCosine[(i + 8) % 4], cosine, GU_SINCOS_FAST_MAX_ERROR);
+        }
+    }
+
+    TEST_F(TrigonometryTests, CalculateDifferenceFast) {
+        for (int i = 0; i < 3600; i++) {
+            const double heading = deg_d_to_rad_d(d_to_deg_d(static_cast<double>(i) * 0.1));
+            const gu_cartesian_coordinate expected = calculate_difference(300.0, -400.0, 0.25, heading);
+            const gu_cartesian_coordinate actual = calculate_difference_fast(300.0, -400.0, 0.25, heading);
+            ASSERT_LE(abs(expected.x - actual.x), 1);
+            ASSERT_LE(abs(expected.y - actual.y), 1);
+        }
+        const gu_cartesian_coordinate expected = {-71, 495};
+        const gu_cartesian_coordinate actual = calculate_difference_fast(300.0, 400.0, deg_d_to_rad_d(d_to_deg_d(45.0)), 0.0);
+        ASSERT_EQ(expected.x, actual.x);
+        ASSERT_EQ(expected.y, actual.y);
+    }
+
+} //namespace
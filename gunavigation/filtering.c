@@ -57,6 +57,8 @@
  */
 
 #include "filtering.h"
+#include "math.h"
+#include "vectorisation.h"
 
 gu_kalman_object kalman_filter(gu_kalman_object object, gu_kalman_object expectedChange, gu_kalman_object sensorReading)
 {
@@ -69,15 +71,115 @@ gu_kalman_object kalman_filter(gu_kalman_object object, gu_kalman_object expecte
     return filteredReading;
 }
 
+static void kalman_filter_bank_all(
+    double * GU_RESTRICT observable,
+    double * GU_RESTRICT variance,
+    const double * GU_RESTRICT changeObservable,
+    const double * GU_RESTRICT changeVariance,
+    const double * GU_RESTRICT readingObservable,
+    const double * GU_RESTRICT readingVariance,
+    const size_t count
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        const double p1Minus = variance[i] + changeVariance[i]; //expected variance
+        const double kalmanConstant = p1Minus / (p1Minus + readingVariance[i]);
+        const double y1Minus = observable[i] + changeObservable[i]; //expected observable
+        observable[i] = y1Minus + kalmanConstant * (readingObservable[i] - y1Minus); //filtered observable
+        variance[i] = (1 - kalmanConstant) * p1Minus; //filtered variance
+    }
+}
 
+static void kalman_filter_bank_masked(
+    double * GU_RESTRICT observable,
+    double * GU_RESTRICT variance,
+    const double * GU_RESTRICT changeObservable,
+    const double * GU_RESTRICT changeVariance,
+    const double * GU_RESTRICT readingObservable,
+    const double * GU_RESTRICT readingVariance,
+    const uint8_t * GU_RESTRICT valid,
+    const size_t count
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        // A zero gain keeps only the prediction. Multiplying by the mask rather than
+        // selecting keeps the loop free of control flow so that it vectorises.
+        const double mask = valid[i] ? 1.0 : 0.0;
+        const double p1Minus = variance[i] + changeVariance[i]; //expected variance
+        const double kalmanConstant = mask * (p1Minus / (p1Minus + readingVariance[i]));
+        const double y1Minus = observable[i] + changeObservable[i]; //expected observable
+        observable[i] = y1Minus + kalmanConstant * (readingObservable[i] - y1Minus); //filtered observable
+        variance[i] = (1 - kalmanConstant) * p1Minus; //filtered variance
+    }
+}
 
+void kalman_filter_bank(const gu_kalman_bank objects, const gu_kalman_bank expectedChanges, const gu_kalman_bank sensorReadings, const uint8_t *valid, const size_t count)
+{
+    if (valid == NULL) {
+        kalman_filter_bank_all(
+            objects.observable,
+            objects.variance,
+            expectedChanges.observable,
+            expectedChanges.variance,
+            sensorReadings.observable,
+            sensorReadings.variance,
+            count
+        );
+        return;
+    }
+    kalman_filter_bank_masked(
+        objects.observable,
+        objects.variance,
+        expectedChanges.observable,
+        expectedChanges.variance,
+        sensorReadings.observable,
+        sensorReadings.variance,
+        valid,
+        count
+    );
+}
 
+gu_kalman_filter gu_kalman_filter_create(const gu_kalman_object initial, const double expectedChangeVariance, const double sensorVariance)
+{
+    const gu_kalman_filter filter = {initial, 0.0, 0.0, 0.0, 0.0, false};
+    return gu_kalman_filter_set_variances(filter, expectedChangeVariance, sensorVariance);
+}
 
+gu_kalman_filter gu_kalman_filter_set_variances(const gu_kalman_filter filter, const double expectedChangeVariance, const double sensorVariance)
+{
+    // The steady state expected variance M solves M^2 - QM - QR = 0.
+    const double q = expectedChangeVariance;
+    const double r = sensorVariance;
+    const double expectedVariance = (q + sqrt(q * q + 4.0 * q * r)) / 2.0;
+    const double total = expectedVariance + r;
+    const double gain = total <= 0.0 ? 0.0 : expectedVariance / total;
+    const gu_kalman_filter newFilter = {
+        filter.state,
+        expectedChangeVariance,
+        sensorVariance,
+        gain,
+        (1 - gain) * expectedVariance,
+        false
+    };
+    return newFilter;
+}
 
-
-
-
-
-
-
-
+gu_kalman_filter gu_kalman_filter_update(const gu_kalman_filter filter, const double expectedChange, const double sensorReading)
+{
+    gu_kalman_filter newFilter = filter;
+    if (filter.converged) {
+        const double y1Minus = filter.state.observable + expectedChange; //expected observable
+        newFilter.state.observable = y1Minus + filter.steadyStateGain * (sensorReading - y1Minus); //filtered observable
+        return newFilter;
+    }
+    const gu_kalman_object change = {expectedChange, filter.expectedChangeVariance};
+    const gu_kalman_object reading = {sensorReading, filter.sensorVariance};
+    newFilter.state = kalman_filter(filter.state, change, reading);
+    newFilter.converged = fabs(newFilter.state.variance - filter.steadyStateVariance) <= GU_KALMAN_CONVERGENCE_TOLERANCE * filter.steadyStateVariance;
+    if (newFilter.converged) {
+        newFilter.state.variance = filter.steadyStateVariance;
+    }
+    return newFilter;
+}
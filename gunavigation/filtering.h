@@ -59,10 +59,20 @@
 #ifndef FILTERING_H
 #define FILTERING_H
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * The relative difference between the filtered variance and the steady
+ * state variance below which a gu_kalman_filter is considered converged.
+ */
+#define GU_KALMAN_CONVERGENCE_TOLERANCE 1.0e-9
+
 typedef struct gu_kalman_object {
     
     double observable;
@@ -73,6 +83,77 @@ typedef struct gu_kalman_object {
 
 gu_kalman_object kalman_filter(gu_kalman_object object, gu_kalman_object expectedChange, gu_kalman_object sensorReading) __attribute__((const));
 
+/**
+ * A structure-of-arrays view over many gu_kalman_object values.
+ *
+ * The arrays are owned by the caller.
+ */
+typedef struct gu_kalman_bank {
+
+    double *observable;
+
+    double *variance;
+
+} gu_kalman_bank;
+
+/**
+ * Apply kalman_filter to `count` independent filters in place.
+ *
+ * Element i of objects is filtered with element i of expectedChanges and
+ * sensorReadings, giving bit-identical results to kalman_filter. Filters
+ * whose entry in valid is zero had no reading this frame and only receive
+ * the prediction step. Their sensor reading is weighted by a zero gain, so
+ * it may hold any finite placeholder value but must not be NaN or infinite.
+ * valid may be NULL when every filter has a reading.
+ *
+ * The loop is branch free so that the compiler can vectorise it. None of
+ * the arrays may overlap.
+ */
+void kalman_filter_bank(const gu_kalman_bank objects, const gu_kalman_bank expectedChanges, const gu_kalman_bank sensorReadings, const uint8_t *valid, const size_t count);
+
+/**
+ * A scalar Kalman filter for a signal whose expected change variance and
+ * sensor variance are constant.
+ *
+ * With constant variances the Kalman gain converges to a fixed value. The
+ * steady state gain and variance are precomputed when the variances are
+ * set. The filter runs the full update until its variance reaches the
+ * steady state, after which it switches to a division-free fixed-gain update.
+ */
+typedef struct gu_kalman_filter {
+
+    gu_kalman_object state;
+
+    double expectedChangeVariance;
+
+    double sensorVariance;
+
+    /**
+     * The gain and variance that the filter converges to.
+     */
+    double steadyStateGain;
+
+    double steadyStateVariance;
+
+    bool converged;
+
+} gu_kalman_filter;
+
+gu_kalman_filter gu_kalman_filter_create(const gu_kalman_object initial, const double expectedChangeVariance, const double sensorVariance) __attribute__((const));
+
+/**
+ * Change the variances of the filter, recomputing the steady state and
+ * returning to the full update until the filter converges again.
+ */
+gu_kalman_filter gu_kalman_filter_set_variances(const gu_kalman_filter filter, const double expectedChangeVariance, const double sensorVariance) __attribute__((const));
+
+/**
+ * Filter a new sensor reading given the expected change since the last
+ * reading. Equivalent to kalman_filter with the filter's variances until
+ * the filter has converged.
+ */
+gu_kalman_filter gu_kalman_filter_update(const gu_kalman_filter filter, const double expectedChange, const double sensorReading) __attribute__((const));
+
 
 #ifdef __cplusplus
 }
@@ -59,10 +59,20 @@
 #ifndef GUNAVIGATION_H
 #define GUNAVIGATION_H
 
-//#include "arcs.h"
+#include "arcs.h"
 #include "control.h"
+#include "control_f.h"
+#include "control_q16.h"
 #include "tracking.h"
+#include "pose_history.h"
 #include "sightings.h"
+#include "sighting_ring.h"
+#include "sighting_shm.h"
+#include "sighting_store.h"
+#include "assignment.h"
+#include "localisation.h"
+#include "object_tracker.h"
 #include "filtering.h"
+#include "trigonometry.h"
 
 #endif  /* GUNAVIGATION_H */
@@ -60,5 +60,12 @@
 #define GUNAVIGATION_HPP
 
 #include "Arcs.hpp"
+#include "Controller.hpp"
+#include "KalmanFilter.hpp"
+#include "LocalisationWorkers.hpp"
+#include "NavigationSnapshot.hpp"
+#include "OdometryTracker.hpp"
+#include "SPSCQueue.hpp"
+#include "Seqlock.hpp"
 
 #endif  /* GUNAVIGATION_HPP */
@@ -0,0 +1,385 @@
+/*
+ * localisation.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "localisation.h"
+#include "trigonometry.h"
+#include "vectorisation.h"
+
+#include <math.h>
+#include <string.h>
+
+#define TWO_PI 6.28318530717958647693
+
+static uint32_t next_random(uint32_t state)
+{
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/**
+ * A uniform sample in [0, 1). The conversion goes through a signed integer
+ * because it has vector instructions where unsigned conversion does not.
+ */
+static double uniform(const uint32_t state)
+{
+    return (double) (int32_t) (state >> 8) * (1.0 / 16777216.0);
+}
+
+/**
+ * An approximately standard normal sample, from the sum of four uniform
+ * samples, which needs no library calls and so vectorises.
+ */
+static double normal(uint32_t *state)
+{
+    double sum = 0.0;
+    int i;
+    for (i = 0; i < 4; i++) {
+        *state = next_random(*state);
+        sum += uniform(*state);
+    }
+    return (sum - 2.0) * 1.73205080756887729353;
+}
+
+static uint64_t split_mix(uint64_t *state)
+{
+    *state += 0x9E3779B97F4A7C15ull;
+    uint64_t value = *state;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+/*
+ * Wrap an angle to [-pi, pi]. The number of turns is rounded with
+ * gu_round_integral instead of floor, which has no vector instruction
+ * before SSE4.1.
+ */
+static double wrap_radians(const double angle)
+{
+    const double turns = gu_round_integral(angle * (1.0 / TWO_PI));
+    return angle - TWO_PI * turns;
+}
+
+static void sample_motion(
+    uint32_t * GU_RESTRICT random,
+    const double * GU_RESTRICT heading,
+    double * GU_RESTRICT forward,
+    double * GU_RESTRICT left,
+    double * GU_RESTRICT angle,
+    const size_t count,
+    const gu_mcl_motion motion,
+    const gu_mcl_motion deviation
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        uint32_t state = random[i];
+        forward[i] = motion.forward + deviation.forward * normal(&state);
+        left[i] = motion.left + deviation.left * normal(&state);
+        angle[i] = heading[i] + motion.turn + deviation.turn * normal(&state);
+        random[i] = state;
+    }
+}
+
+static void apply_motion(
+    double * GU_RESTRICT x,
+    double * GU_RESTRICT y,
+    double * GU_RESTRICT heading,
+    const double * GU_RESTRICT forward,
+    const double * GU_RESTRICT left,
+    const double * GU_RESTRICT angle,
+    const double * GU_RESTRICT sine,
+    const double * GU_RESTRICT cosine,
+    const size_t count
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        x[i] += forward[i] * cosine[i] - left[i] * sine[i];
+        y[i] += forward[i] * sine[i] + left[i] * cosine[i];
+        heading[i] = wrap_radians(angle[i]);
+    }
+}
+
+static void weigh_landmark(
+    double * GU_RESTRICT logWeight,
+    const double * GU_RESTRICT x,
+    const double * GU_RESTRICT y,
+    const double * GU_RESTRICT sine,
+    const double * GU_RESTRICT cosine,
+    const size_t count,
+    const double landmarkX,
+    const double landmarkY,
+    const double observedX,
+    const double observedY,
+    const double scale
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        // The landmark relative to the particle.
+        const double dx = landmarkX - x[i];
+        const double dy = landmarkY - y[i];
+        const double errorX = cosine[i] * dx + sine[i] * dy - observedX;
+        const double errorY = cosine[i] * dy - sine[i] * dx - observedY;
+        logWeight[i] += scale * (errorX * errorX + errorY * errorY);
+    }
+}
+
+bool gu_mcl_init(
+    gu_mcl *mcl,
+    const size_t count,
+    const gu_field_coordinate pose,
+    const double positionDeviation,
+    const double headingDeviation,
+    const gu_odometry_reading initialReading,
+    const gu_mcl_noise noise,
+    const uint64_t seed
+)
+{
+    if (count == 0 || count > GU_MCL_MAX_PARTICLES) {
+        return false;
+    }
+    mcl->count = count;
+    mcl->noise = noise;
+    mcl->last_reading = initialReading;
+    mcl->seed = seed;
+    const double heading = deg_t_to_rad_d(pose.heading);
+    size_t i;
+    for (i = 0; i < count; i++) {
+        uint32_t state = (uint32_t) split_mix(&mcl->seed);
+        state = state == 0 ? 1 : state;
+        mcl->x[i] = (double) pose.position.x + positionDeviation * normal(&state);
+        mcl->y[i] = (double) pose.position.y + positionDeviation * normal(&state);
+        mcl->heading[i] = wrap_radians(heading + headingDeviation * normal(&state));
+        mcl->weight[i] = 1.0 / (double) count;
+        mcl->logWeight[i] = 0.0;
+        mcl->random[i] = state;
+    }
+    return true;
+}
+
+gu_mcl_motion gu_mcl_motion_between(const gu_odometry_reading currentReading, const gu_odometry_reading lastReading)
+{
+    gu_mcl_motion motion;
+    if (currentReading.resetCounter != lastReading.resetCounter) {
+        motion.forward = mm_t_to_d(currentReading.forward);
+        motion.left = mm_t_to_d(currentReading.left);
+        motion.turn = rad_d_to_d(currentReading.turn);
+        return motion;
+    }
+    motion.forward = mm_t_to_d(currentReading.forward - lastReading.forward);
+    motion.left = mm_t_to_d(currentReading.left - lastReading.left);
+    motion.turn = rad_d_to_d(currentReading.turn - lastReading.turn);
+    return motion;
+}
+
+void gu_mcl_predict_range(gu_mcl *mcl, const gu_mcl_motion motion, const size_t begin, const size_t end)
+{
+    if (begin >= end) {
+        return;
+    }
+    const size_t count = end - begin;
+    const gu_mcl_noise noise = mcl->noise;
+    const double distance = fabs(motion.forward) + fabs(motion.left);
+    gu_mcl_motion deviation;
+    deviation.forward = noise.forward * fabs(motion.forward);
+    deviation.left = noise.left * fabs(motion.left);
+    deviation.turn = noise.turn * fabs(motion.turn) + noise.turnPerMillimetre * distance;
+    sample_motion(&mcl->random[begin], &mcl->heading[begin], &mcl->forward[begin], &mcl->left[begin], &mcl->angle[begin], count, motion, deviation);
+    gu_sincos_fast_batch(&mcl->angle[begin], &mcl->sine[begin], &mcl->cosine[begin], count);
+    apply_motion(
+        &mcl->x[begin],
+        &mcl->y[begin],
+        &mcl->heading[begin],
+        &mcl->forward[begin],
+        &mcl->left[begin],
+        &mcl->angle[begin],
+        &mcl->sine[begin],
+        &mcl->cosine[begin],
+        count
+    );
+}
+
+void gu_mcl_predict(gu_mcl *mcl, const gu_odometry_reading reading)
+{
+    gu_mcl_predict_range(mcl, gu_mcl_motion_between(reading, mcl->last_reading), 0, mcl->count);
+    mcl->last_reading = reading;
+}
+
+void gu_mcl_weight_landmark(gu_mcl *mcl, const gu_cartesian_coordinate landmark, const gu_relative_coordinate sighting, const double deviation)
+{
+    const gu_cartesian_coordinate observed = rr_coord_to_cartesian_coord(sighting);
+    gu_sincos_fast_batch(mcl->heading, mcl->sine, mcl->cosine, mcl->count);
+    weigh_landmark(
+        mcl->logWeight,
+        mcl->x,
+        mcl->y,
+        mcl->sine,
+        mcl->cosine,
+        mcl->count,
+        (double) landmark.x,
+        (double) landmark.y,
+        (double) observed.x,
+        (double) observed.y,
+        -1.0 / (2.0 * deviation * deviation)
+    );
+}
+
+static double max_log_weight(const gu_mcl *mcl)
+{
+    double maximum = mcl->logWeight[0];
+    size_t i;
+    for (i = 1; i < mcl->count; i++) {
+        maximum = mcl->logWeight[i] > maximum ? mcl->logWeight[i] : maximum;
+    }
+    return maximum;
+}
+
+double gu_mcl_normalise(gu_mcl *mcl)
+{
+    // Shifting by the largest log-likelihood keeps the most likely particle's
+    // factor at one, so the weights cannot all underflow to zero however many
+    // landmarks were seen.
+    const double maximum = max_log_weight(mcl);
+    double total = 0.0;
+    size_t i;
+    for (i = 0; i < mcl->count; i++) {
+        mcl->weight[i] *= exp(mcl->logWeight[i] - maximum);
+        mcl->logWeight[i] = 0.0;
+        total += mcl->weight[i];
+    }
+    const double scale = total > 0.0 ? 1.0 / total : 0.0;
+    const double fallback = total > 0.0 ? 0.0 : 1.0 / (double) mcl->count;
+    for (i = 0; i < mcl->count; i++) {
+        mcl->weight[i] = mcl->weight[i] * scale + fallback;
+    }
+    return total;
+}
+
+double gu_mcl_effective_particles(const gu_mcl *mcl)
+{
+    double total = 0.0;
+    size_t i;
+    for (i = 0; i < mcl->count; i++) {
+        total += mcl->weight[i] * mcl->weight[i];
+    }
+    return total > 0.0 ? 1.0 / total : 0.0;
+}
+
+void gu_mcl_resample(gu_mcl *mcl)
+{
+    const size_t count = mcl->count;
+    const double total = gu_mcl_normalise(mcl);
+    if (!(total > 0.0)) {
+        return;
+    }
+    const double step = 1.0 / (double) count;
+    uint32_t state = (uint32_t) split_mix(&mcl->seed);
+    const double start = uniform(state) * step;
+    double cumulative = mcl->weight[0];
+    size_t source = 0;
+    size_t i;
+    // The resampled poses are gathered into the scratch space. Each slot
+    // keeps its own random number generator so that copies of the same
+    // particle diverge.
+    for (i = 0; i < count; i++) {
+        const double target = start + (double) i * step;
+        while (target > cumulative && source + 1 < count) {
+            source++;
+            cumulative += mcl->weight[source];
+        }
+        mcl->forward[i] = mcl->x[source];
+        mcl->left[i] = mcl->y[source];
+        mcl->angle[i] = mcl->heading[source];
+    }
+    memcpy(mcl->x, mcl->forward, count * sizeof(double));
+    memcpy(mcl->y, mcl->left, count * sizeof(double));
+    memcpy(mcl->heading, mcl->angle, count * sizeof(double));
+    for (i = 0; i < count; i++) {
+        mcl->weight[i] = step;
+    }
+}
+
+gu_field_coordinate gu_mcl_estimate(const gu_mcl *mcl)
+{
+    const double maximum = max_log_weight(mcl);
+    double total = 0.0;
+    double x = 0.0;
+    double y = 0.0;
+    double sine = 0.0;
+    double cosine = 0.0;
+    size_t i;
+    for (i = 0; i < mcl->count; i++) {
+        const double weight = mcl->weight[i] * exp(mcl->logWeight[i] - maximum);
+        total += weight;
+        x += weight * mcl->x[i];
+        y += weight * mcl->y[i];
+        sine += weight * sin(mcl->heading[i]);
+        cosine += weight * cos(mcl->heading[i]);
+    }
+    const double scale = total > 0.0 ? 1.0 / total : 0.0;
+    gu_field_coordinate estimate;
+    estimate.position.x = d_to_mm_t(x * scale);
+    estimate.position.y = d_to_mm_t(y * scale);
+    estimate.heading = rad_d_to_deg_t(atan2(sine, cosine));
+    return estimate;
+}
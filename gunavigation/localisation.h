@@ -0,0 +1,264 @@
+/*
+ * localisation.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef LOCALISATION_H
+#define LOCALISATION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+#include "tracking.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The maximum number of particles in a gu_mcl.
+ */
+#ifndef GU_MCL_MAX_PARTICLES
+#define GU_MCL_MAX_PARTICLES 1024
+#endif
+
+/**
+ * The standard deviations of the noise added to each particle's motion,
+ * proportional to the size of the motion.
+ */
+typedef struct gu_mcl_noise {
+
+    /**
+     * Per millimetre moved forward.
+     */
+    double forward;
+
+    /**
+     * Per millimetre moved left.
+     */
+    double left;
+
+    /**
+     * Per radian turned.
+     */
+    double turn;
+
+    /**
+     * Radians per millimetre moved in any direction.
+     */
+    double turnPerMillimetre;
+
+} gu_mcl_noise;
+
+/**
+ * The motion between two odometry readings, in millimetres and radians.
+ */
+typedef struct gu_mcl_motion {
+
+    double forward;
+
+    double left;
+
+    double turn;
+
+} gu_mcl_motion;
+
+/**
+ * A Monte Carlo localisation particle filter over the robot's field pose.
+ *
+ * The particles are stored as a structure of arrays inside the filter,
+ * together with the scratch space used by the motion update and resampling,
+ * so the filter never allocates. Each particle has its own random number
+ * generator, so the motion update of disjoint ranges of particles may run
+ * on different threads and gives the same result however the particles are
+ * divided.
+ */
+typedef struct gu_mcl {
+
+    size_t count;
+
+    gu_mcl_noise noise;
+
+    gu_odometry_reading last_reading;
+
+    /**
+     * The state of the generator used for resampling.
+     */
+    uint64_t seed;
+
+    /**
+     * The position of each particle in millimetres.
+     */
+    double x[GU_MCL_MAX_PARTICLES];
+
+    double y[GU_MCL_MAX_PARTICLES];
+
+    /**
+     * The heading of each particle in radians.
+     */
+    double heading[GU_MCL_MAX_PARTICLES];
+
+    double weight[GU_MCL_MAX_PARTICLES];
+
+    /**
+     * The log-likelihood of the observations made since the weights were
+     * last normalised, which gu_mcl_normalise folds into weight.
+     */
+    double logWeight[GU_MCL_MAX_PARTICLES];
+
+    uint32_t random[GU_MCL_MAX_PARTICLES];
+
+    // Scratch space.
+
+    double forward[GU_MCL_MAX_PARTICLES];
+
+    double left[GU_MCL_MAX_PARTICLES];
+
+    double angle[GU_MCL_MAX_PARTICLES];
+
+    double sine[GU_MCL_MAX_PARTICLES];
+
+    double cosine[GU_MCL_MAX_PARTICLES];
+
+} gu_mcl;
+
+/**
+ * Initialise count particles, with equal weights, normally distributed
+ * around pose.
+ *
+ * Returns false if count is zero or larger than GU_MCL_MAX_PARTICLES.
+ */
+bool gu_mcl_init(
+    gu_mcl *mcl,
+    const size_t count,
+    const gu_field_coordinate pose,
+    const double positionDeviation,
+    const double headingDeviation,
+    const gu_odometry_reading initialReading,
+    const gu_mcl_noise noise,
+    const uint64_t seed
+);
+
+/**
+ * The motion between two readings, handling counter resets as track() does.
+ */
+gu_mcl_motion gu_mcl_motion_between(const gu_odometry_reading currentReading, const gu_odometry_reading lastReading) __attribute__((const));
+
+/**
+ * Move the particles in [begin, end) by motion with sampled noise.
+ *
+ * Each particle is moved as calculate_difference moves the robot: its
+ * heading is turned first and the forward and left motion is then rotated
+ * by the new heading. The work is split into vectorised passes for the
+ * noise, the sines and cosines, and the moves. Disjoint ranges may be
+ * moved concurrently.
+ */
+void gu_mcl_predict_range(gu_mcl *mcl, const gu_mcl_motion motion, const size_t begin, const size_t end);
+
+/**
+ * Move every particle by the motion since the last reading.
+ */
+void gu_mcl_predict(gu_mcl *mcl, const gu_odometry_reading reading);
+
+/**
+ * Weight each particle by the likelihood of sighting a landmark at a known
+ * field position, with a normally distributed error of deviation
+ * millimetres in each direction.
+ *
+ * The log-likelihood is accumulated so that several sightings may be
+ * combined without underflowing; weight is only updated by
+ * gu_mcl_normalise.
+ */
+void gu_mcl_weight_landmark(gu_mcl *mcl, const gu_cartesian_coordinate landmark, const gu_relative_coordinate sighting, const double deviation);
+
+/**
+ * Fold the accumulated log-likelihoods into the weights and scale the
+ * weights so that they sum to one.
+ *
+ * The log-likelihoods are shifted so that the largest is zero before they
+ * are exponentiated. Returns the sum of the weights before scaling. If every
+ * weight is zero the weights are reset to be equal.
+ */
+double gu_mcl_normalise(gu_mcl *mcl);
+
+/**
+ * The effective number of particles, 1 / sum(weight^2), of normalised
+ * weights.
+ */
+double gu_mcl_effective_particles(const gu_mcl *mcl) __attribute__((pure));
+
+/**
+ * Draw a new set of equally weighted particles in proportion to their
+ * weights with low variance resampling, in O(count) and without allocating.
+ */
+void gu_mcl_resample(gu_mcl *mcl);
+
+/**
+ * The weighted mean pose of the particles, including any log-likelihoods
+ * that have not yet been normalised.
+ */
+gu_field_coordinate gu_mcl_estimate(const gu_mcl *mcl) __attribute__((pure));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* LOCALISATION_H */
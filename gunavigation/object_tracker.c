@@ -0,0 +1,210 @@
+/*
+ * object_tracker.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "object_tracker.h"
+#include "filtering.h"
+#include "tracking.h"
+
+/*
+ * The optimal assignment must have room for every object and sighting.
+ */
+#if GU_OBJECT_TRACKER_CAPACITY > GU_ASSIGNMENT_MAX_TRACKS
+#error GU_OBJECT_TRACKER_CAPACITY must not exceed GU_ASSIGNMENT_MAX_TRACKS
+#endif
+
+#if GU_OBJECT_TRACKER_MAX_SIGHTINGS > GU_ASSIGNMENT_MAX_SIGHTINGS
+#error GU_OBJECT_TRACKER_MAX_SIGHTINGS must not exceed GU_ASSIGNMENT_MAX_SIGHTINGS
+#endif
+
+static void retire(gu_object_tracker *tracker, const size_t index)
+{
+    const size_t last = tracker->count - 1;
+    tracker->ids[index] = tracker->ids[last];
+    tracker->lastSeen[index] = tracker->lastSeen[last];
+    tracker->x[index] = tracker->x[last];
+    tracker->xVariance[index] = tracker->xVariance[last];
+    tracker->y[index] = tracker->y[last];
+    tracker->yVariance[index] = tracker->yVariance[last];
+    tracker->count = last;
+}
+
+static void spawn(gu_object_tracker *tracker, const gu_cartesian_coordinate position, const uint64_t frame)
+{
+    const size_t index = tracker->count;
+    tracker->ids[index] = tracker->nextId++;
+    tracker->lastSeen[index] = frame;
+    tracker->x[index] = (double) position.x;
+    tracker->xVariance[index] = tracker->parameters.sensorVariance;
+    tracker->y[index] = (double) position.y;
+    tracker->yVariance[index] = tracker->parameters.sensorVariance;
+    tracker->count++;
+}
+
+static size_t assign_optimally(gu_object_tracker *tracker)
+{
+    const size_t sightingCount = tracker->store.count;
+    size_t i;
+    for (i = 0; i < sightingCount; i++) {
+        tracker->sightingPositions[i] = tracker->entries[i].position;
+    }
+    const size_t associated = gu_assign_gated(&tracker->assignment, tracker->predicted, tracker->count, tracker->sightingPositions, sightingCount, tracker->parameters.gate, tracker->assignments);
+    for (i = 0; i < tracker->count; i++) {
+        if (tracker->assignments[i] != GU_ASSIGNMENT_NONE) {
+            tracker->entries[tracker->assignments[i]].claimed = true;
+        }
+    }
+    return associated;
+}
+
+bool gu_object_tracker_init(gu_object_tracker *tracker, const gu_object_tracker_parameters parameters)
+{
+    if (!(parameters.processVariance > 0.0) || !(parameters.sensorVariance > 0.0) || parameters.gate == 0) {
+        return false;
+    }
+    tracker->parameters = parameters;
+    tracker->count = 0;
+    tracker->nextId = 0;
+    const millimetres_t cellSize = parameters.gate > (millimetres_u) INT32_MAX ? INT32_MAX : (millimetres_t) parameters.gate;
+    return gu_sighting_store_init(&tracker->store, tracker->entries, GU_OBJECT_TRACKER_MAX_SIGHTINGS, tracker->buckets, GU_OBJECT_TRACKER_BUCKETS, cellSize);
+}
+
+size_t gu_object_tracker_update(
+    gu_object_tracker *tracker,
+    const gu_field_coordinate oldPosition,
+    const gu_field_coordinate newPosition,
+    const gu_sighting *sightings,
+    const size_t sightingCount,
+    const uint64_t frame
+)
+{
+    const size_t count = tracker->count;
+    // Move every object by the same rigid transform as the robot's targets
+    // and keep the movement as the change for the filters.
+    size_t i;
+    for (i = 0; i < count; i++) {
+        tracker->changeX[i] = tracker->x[i];
+        tracker->changeY[i] = tracker->y[i];
+    }
+    const gu_relative_cartesian_coordinates moved = {tracker->changeX, tracker->changeY};
+    update_targets_from_movement(oldPosition, newPosition, moved, count);
+    for (i = 0; i < count; i++) {
+        tracker->predicted[i].x = d_to_mm_t(tracker->changeX[i]);
+        tracker->predicted[i].y = d_to_mm_t(tracker->changeY[i]);
+        tracker->changeX[i] -= tracker->x[i];
+        tracker->changeY[i] -= tracker->y[i];
+        tracker->changeVariance[i] = tracker->parameters.processVariance;
+        tracker->sensorVariance[i] = tracker->parameters.sensorVariance;
+    }
+    // Associate sightings with the predicted positions.
+    gu_sighting_store_clear(&tracker->store);
+    for (i = 0; i < sightingCount && gu_sighting_store_insert(&tracker->store, sightings[i]); i++) {}
+    const size_t associated = tracker->parameters.optimalAssignment
+        ? assign_optimally(tracker)
+        : gu_sighting_store_associate(&tracker->store, tracker->predicted, count, tracker->parameters.gate, tracker->assignments);
+    for (i = 0; i < count; i++) {
+        const size_t assignment = tracker->assignments[i];
+        // Both assignments mark an unassigned object with an index beyond
+        // the sightings.
+        const bool seen = assignment < tracker->store.count;
+        tracker->valid[i] = seen ? 1 : 0;
+        tracker->sensorX[i] = seen ? (double) tracker->entries[assignment].position.x : 0.0;
+        tracker->sensorY[i] = seen ? (double) tracker->entries[assignment].position.y : 0.0;
+        tracker->lastSeen[i] = seen ? frame : tracker->lastSeen[i];
+    }
+    const gu_kalman_bank xs = {tracker->x, tracker->xVariance};
+    const gu_kalman_bank ys = {tracker->y, tracker->yVariance};
+    const gu_kalman_bank xChanges = {tracker->changeX, tracker->changeVariance};
+    const gu_kalman_bank yChanges = {tracker->changeY, tracker->changeVariance};
+    const gu_kalman_bank xReadings = {tracker->sensorX, tracker->sensorVariance};
+    const gu_kalman_bank yReadings = {tracker->sensorY, tracker->sensorVariance};
+    kalman_filter_bank(xs, xChanges, xReadings, tracker->valid, count);
+    kalman_filter_bank(ys, yChanges, yReadings, tracker->valid, count);
+    // Retire stale objects before spawning so that their slots are reused.
+    i = 0;
+    while (i < tracker->count) {
+        if (frame >= tracker->lastSeen[i] && frame - tracker->lastSeen[i] > tracker->parameters.maxAge) {
+            retire(tracker, i);
+        } else {
+            i++;
+        }
+    }
+    for (i = 0; i < tracker->store.count && tracker->count < GU_OBJECT_TRACKER_CAPACITY; i++) {
+        if (!tracker->entries[i].claimed) {
+            spawn(tracker, tracker->entries[i].position, frame);
+        }
+    }
+    return associated;
+}
+
+gu_relative_coordinate gu_object_tracker_location(const gu_object_tracker *tracker, const size_t index)
+{
+    const gu_cartesian_coordinate position = {d_to_mm_t(tracker->x[index]), d_to_mm_t(tracker->y[index])};
+    return cartesian_coord_to_rr_coord(position);
+}
+
+size_t gu_object_tracker_find(const gu_object_tracker *tracker, const uint32_t id)
+{
+    size_t i;
+    for (i = 0; i < tracker->count; i++) {
+        if (tracker->ids[i] == id) {
+            return i;
+        }
+    }
+    return GU_OBJECT_TRACKER_NONE;
+}
@@ -0,0 +1,242 @@
+/*
+ * object_tracker.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef OBJECT_TRACKER_H
+#define OBJECT_TRACKER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <guunits/guunits.h>
+#include <gucoordinates/gucoordinates.h>
+
+#include "sightings.h"
+#include "sighting_store.h"
+#include "assignment.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The maximum number of objects a gu_object_tracker follows.
+ */
+#ifndef GU_OBJECT_TRACKER_CAPACITY
+#define GU_OBJECT_TRACKER_CAPACITY 64
+#endif
+
+/**
+ * The maximum number of sightings a gu_object_tracker considers per frame.
+ */
+#ifndef GU_OBJECT_TRACKER_MAX_SIGHTINGS
+#define GU_OBJECT_TRACKER_MAX_SIGHTINGS 128
+#endif
+
+/**
+ * The index gu_object_tracker_find returns for an unknown id.
+ */
+#define GU_OBJECT_TRACKER_NONE ((size_t) -1)
+
+#define GU_OBJECT_TRACKER_BUCKETS 256
+
+typedef struct gu_object_tracker_parameters {
+
+    /**
+     * The variance (mm^2) added to each coordinate of an object every frame.
+     */
+    double processVariance;
+
+    /**
+     * The variance (mm^2) of each coordinate of a sighting.
+     */
+    double sensorVariance;
+
+    /**
+     * The furthest a sighting may be from an object's predicted position
+     * and still be associated with it.
+     */
+    millimetres_u gate;
+
+    /**
+     * The number of frames an object may go unseen before it is retired.
+     */
+    uint64_t maxAge;
+
+    /**
+     * Associate sightings with gu_assign_gated, which keeps objects apart
+     * when they cross, rather than greedily with gu_sighting_store_associate.
+     */
+    bool optimalAssignment;
+
+} gu_object_tracker_parameters;
+
+/**
+ * Follows many objects relative to the robot from their sightings.
+ *
+ * Each coordinate of each object is filtered with kalman_filter_bank. The
+ * objects are stored as a structure of arrays, with the active objects
+ * packed into the first count elements, so the cost of a frame grows with
+ * the number of objects. All storage, including the per-frame scratch
+ * space, is part of the structure so the tracker never allocates.
+ */
+typedef struct gu_object_tracker {
+
+    gu_object_tracker_parameters parameters;
+
+    size_t count;
+
+    uint32_t nextId;
+
+    uint32_t ids[GU_OBJECT_TRACKER_CAPACITY];
+
+    /**
+     * The frame in which each object was last sighted.
+     */
+    uint64_t lastSeen[GU_OBJECT_TRACKER_CAPACITY];
+
+    /**
+     * The filtered position of each object relative to the robot, x
+     * forward and y to the left.
+     */
+    double x[GU_OBJECT_TRACKER_CAPACITY];
+
+    double xVariance[GU_OBJECT_TRACKER_CAPACITY];
+
+    double y[GU_OBJECT_TRACKER_CAPACITY];
+
+    double yVariance[GU_OBJECT_TRACKER_CAPACITY];
+
+    // Scratch space reused every frame.
+
+    double changeX[GU_OBJECT_TRACKER_CAPACITY];
+
+    double changeY[GU_OBJECT_TRACKER_CAPACITY];
+
+    double changeVariance[GU_OBJECT_TRACKER_CAPACITY];
+
+    double sensorX[GU_OBJECT_TRACKER_CAPACITY];
+
+    double sensorY[GU_OBJECT_TRACKER_CAPACITY];
+
+    double sensorVariance[GU_OBJECT_TRACKER_CAPACITY];
+
+    uint8_t valid[GU_OBJECT_TRACKER_CAPACITY];
+
+    gu_cartesian_coordinate predicted[GU_OBJECT_TRACKER_CAPACITY];
+
+    size_t assignments[GU_OBJECT_TRACKER_CAPACITY];
+
+    gu_sighting_store store;
+
+    gu_sighting_store_entry entries[GU_OBJECT_TRACKER_MAX_SIGHTINGS];
+
+    gu_sighting_store_bucket buckets[GU_OBJECT_TRACKER_BUCKETS];
+
+    gu_cartesian_coordinate sightingPositions[GU_OBJECT_TRACKER_MAX_SIGHTINGS];
+
+    gu_assignment_workspace assignment;
+
+} gu_object_tracker;
+
+/**
+ * Returns false if the variances are not positive or the gate is zero.
+ */
+bool gu_object_tracker_init(gu_object_tracker *tracker, const gu_object_tracker_parameters parameters);
+
+/**
+ * Process a frame.
+ *
+ * Every object is first moved by the robot's movement from oldPosition to
+ * newPosition, the positions before and after the frame's readings were
+ * given to track(). Each object is then associated with the nearest
+ * unclaimed sighting within the gate of its predicted position and
+ * filtered, or, with optimalAssignment, sightings are assigned to minimise
+ * the total distance. Unassociated sightings start new objects while there
+ * is room, and objects unseen for more than maxAge frames are retired.
+ * Sightings beyond GU_OBJECT_TRACKER_MAX_SIGHTINGS are ignored. A frame
+ * numbered before an object's last sighting does not age it, so frame
+ * numbers that go backwards never retire objects early.
+ *
+ * Returns the number of sightings associated with existing objects.
+ */
+size_t gu_object_tracker_update(
+    gu_object_tracker *tracker,
+    const gu_field_coordinate oldPosition,
+    const gu_field_coordinate newPosition,
+    const gu_sighting *sightings,
+    const size_t sightingCount,
+    const uint64_t frame
+);
+
+/**
+ * The position of the index'th object relative to the robot.
+ */
+gu_relative_coordinate gu_object_tracker_location(const gu_object_tracker *tracker, const size_t index) __attribute__((pure));
+
+/**
+ * The index of the object with the given id, or GU_OBJECT_TRACKER_NONE.
+ */
+size_t gu_object_tracker_find(const gu_object_tracker *tracker, const uint32_t id) __attribute__((pure));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* OBJECT_TRACKER_H */
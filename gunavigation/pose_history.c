@@ -0,0 +1,159 @@
+/*
+ * pose_history.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "pose_history.h"
+#include "ring_index.h"
+
+static uint64_t key_at(const void *history, const size_t index)
+{
+    return gu_pose_history_get((const gu_pose_history *) history, index)->key;
+}
+
+static int interpolate(const int from, const int to, const double ratio)
+{
+    const double difference = ratio * (double) (to - from);
+    return from + (int) (difference < 0.0 ? difference - 0.5 : difference + 0.5);
+}
+
+/*
+ * Wrap an angle in degrees to [-180, 180).
+ */
+static int wrap_degrees(const int angle)
+{
+    const int wrapped = (angle + 180) % 360;
+    return (wrapped < 0 ? wrapped + 360 : wrapped) - 180;
+}
+
+/*
+ * Interpolate along the shorter way around the circle, so that 179 and -179
+ * give a heading near 180 rather than near 0.
+ */
+static int interpolate_heading(const int from, const int to, const double ratio)
+{
+    return wrap_degrees(interpolate(from, from + wrap_degrees(to - from), ratio));
+}
+
+void gu_pose_history_init(gu_pose_history *history, gu_pose_history_entry *buffer, const size_t capacity)
+{
+    history->entries = buffer;
+    history->capacity = capacity;
+    history->start = 0;
+    history->count = 0;
+}
+
+void gu_pose_history_clear(gu_pose_history *history)
+{
+    history->start = 0;
+    history->count = 0;
+}
+
+bool gu_pose_history_push(gu_pose_history *history, const uint64_t key, const gu_odometry_status status)
+{
+    if (history->capacity == 0) {
+        return false;
+    }
+    if (history->count > 0 && key <= gu_pose_history_get(history, history->count - 1)->key) {
+        return false;
+    }
+    const size_t index = gu_ring_index_push(&history->start, &history->count, history->capacity);
+    history->entries[index].key = key;
+    history->entries[index].status = status;
+    return true;
+}
+
+const gu_pose_history_entry *gu_pose_history_get(const gu_pose_history *history, const size_t index)
+{
+    return &history->entries[gu_ring_index_physical(history->start, history->capacity, index)];
+}
+
+bool gu_pose_history_position_at(const gu_pose_history *history, const uint64_t key, gu_field_coordinate *position)
+{
+    if (history->count == 0) {
+        return false;
+    }
+    const gu_pose_history_entry *oldest = gu_pose_history_get(history, 0);
+    const gu_pose_history_entry *newest = gu_pose_history_get(history, history->count - 1);
+    if (key < oldest->key || key > newest->key) {
+        return false;
+    }
+    const size_t lower = gu_ring_index_lower_bound(history, history->count, key, key_at);
+    const gu_pose_history_entry *after = gu_pose_history_get(history, lower);
+    if (after->key == key || lower == 0) {
+        *position = after->status.my_position;
+        return true;
+    }
+    const gu_pose_history_entry *before = gu_pose_history_get(history, lower - 1);
+    const double ratio = (double) (key - before->key) / (double) (after->key - before->key);
+    const gu_field_coordinate from = before->status.my_position;
+    const gu_field_coordinate to = after->status.my_position;
+    position->position.x = interpolate(from.position.x, to.position.x, ratio);
+    position->position.y = interpolate(from.position.y, to.position.y, ratio);
+    position->heading = interpolate_heading(from.heading, to.heading, ratio);
+    return true;
+}
+
+bool gu_pose_history_sighting_to_cartesian_coord(const gu_pose_history *history, const gu_sighting sighting, gu_cartesian_coordinate *coordinate)
+{
+    gu_field_coordinate position;
+    if (!gu_pose_history_position_at(history, sighting.frameNumber, &position)) {
+        return false;
+    }
+    *coordinate = rr_coord_to_cartesian_coord_from_field(sighting.location, position);
+    return true;
+}
@@ -0,0 +1,146 @@
+/*
+ * pose_history.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef POSE_HISTORY_H
+#define POSE_HISTORY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <gucoordinates/gucoordinates.h>
+
+#include "tracking.h"
+#include "sightings.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A status recorded at a particular frame number or timestamp.
+ */
+typedef struct gu_pose_history_entry {
+
+    uint64_t key;
+
+    gu_odometry_status status;
+
+} gu_pose_history_entry;
+
+/**
+ * A fixed-capacity ring buffer of gu_odometry_status ordered by key.
+ *
+ * The entries are stored in a caller supplied buffer so the history never
+ * allocates. Once the buffer is full, pushing a new status discards the
+ * oldest one. Keys (frame numbers or timestamps) must be strictly
+ * increasing.
+ */
+typedef struct gu_pose_history {
+
+    gu_pose_history_entry *entries;
+
+    size_t capacity;
+
+    /**
+     * The physical index of the oldest entry.
+     */
+    size_t start;
+
+    size_t count;
+
+} gu_pose_history;
+
+void gu_pose_history_init(gu_pose_history *history, gu_pose_history_entry *buffer, const size_t capacity);
+
+void gu_pose_history_clear(gu_pose_history *history);
+
+/**
+ * Record a status. Returns false, leaving the history unchanged, if the
+ * key is not greater than the key of the newest entry or if the history
+ * has no capacity.
+ */
+bool gu_pose_history_push(gu_pose_history *history, const uint64_t key, const gu_odometry_status status);
+
+/**
+ * Fetch the i'th oldest entry.
+ */
+const gu_pose_history_entry *gu_pose_history_get(const gu_pose_history *history, const size_t index) __attribute__((pure));
+
+/**
+ * Find the position of the robot at `key` in O(log n).
+ *
+ * When key falls between two recorded entries the position and heading are
+ * linearly interpolated between them. The heading is interpolated the
+ * shorter way around the circle and wrapped to [-180, 180). Returns false if
+ * key lies outside the range of keys currently held by the history.
+ */
+bool gu_pose_history_position_at(const gu_pose_history *history, const uint64_t key, gu_field_coordinate *position);
+
+/**
+ * Project a sighting onto the field using the position of the robot at the
+ * sighting's frame number. Returns false if that frame is not in the history.
+ */
+bool gu_pose_history_sighting_to_cartesian_coord(const gu_pose_history *history, const gu_sighting sighting, gu_cartesian_coordinate *coordinate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* POSE_HISTORY_H */
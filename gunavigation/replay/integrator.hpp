@@ -0,0 +1,56 @@
+/*
+ * integrator.hpp
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#ifndef INTEGRATOR_HPP
+#define INTEGRATOR_HPP
+
+#include "../gunavigation.h"
+
+#include <stddef.h>
+
+namespace GUREPLAY {
+
+    /**
+     * An odometry integration path under test.
+     *
+     * The replay resets each integrator with the initial status and then feeds
+     * it the readings in chunks, timing only the calls to integrate.
+     */
+    class Integrator {
+
+        public:
+
+        virtual ~Integrator() {}
+
+        virtual void reset(const gu_odometry_status initial) = 0;
+
+        virtual void integrate(const gu_odometry_reading *readings, const size_t count) = 0;
+
+        virtual gu_field_coordinate position() const = 0;
+
+        virtual gu_relative_coordinate target() const = 0;
+
+    };
+
+    typedef Integrator * (*IntegratorFactory)();
+
+    /**
+     * Adds an integrator to the list run by the replay. Use the
+     * REPLAY_INTEGRATOR macro rather than calling this directly.
+     */
+    int registerIntegrator(const char *name, IntegratorFactory factory);
+
+}
+
+#define GUREPLAY_CONCAT_(a, b) a##b
+#define GUREPLAY_CONCAT(a, b) GUREPLAY_CONCAT_(a, b)
+
+#define REPLAY_INTEGRATOR(name, type) \
+    static GUREPLAY::Integrator * GUREPLAY_CONCAT(make_, type)() { return new type(); } \
+    static const int GUREPLAY_CONCAT(type, _registered) __attribute__((unused)) = GUREPLAY::registerIntegrator(name, GUREPLAY_CONCAT(make_, type))
+
+#endif /* !INTEGRATOR_HPP */
@@ -0,0 +1,363 @@
+/*
+ * odometry_replay.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "integrator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace GUREPLAY {
+
+    struct RegisteredIntegrator {
+        const char *name;
+        IntegratorFactory factory;
+    };
+
+    static std::vector<RegisteredIntegrator> & integrators()
+    {
+        static std::vector<RegisteredIntegrator> registered;
+        return registered;
+    }
+
+    int registerIntegrator(const char *name, IntegratorFactory factory)
+    {
+        const RegisteredIntegrator integrator = {name, factory};
+        integrators().push_back(integrator);
+        return 0;
+    }
+
+}
+
+/**
+ * The readings are generated at 100Hz.
+ */
+static const double SAMPLE_PERIOD = 0.01;
+
+/**
+ * A uniform value in [min, max) that is reproducible across standard
+ * libraries, unlike std::uniform_real_distribution.
+ */
+static double uniform(std::mt19937_64 &generator, const double min, const double max)
+{
+    const double unit = static_cast<double>(generator() >> 11) * (1.0 / 9007199254740992.0);
+    return min + unit * (max - min);
+}
+
+/**
+ * Generate cumulative odometry readings from a piecewise constant velocity
+ * profile. Occasional spin segments combined with long intervals between
+ * counter resets produce large turn values. The reset counter starts at
+ * 255 so that it wraps to 0 at the first reset, within 20000 readings.
+ */
+static std::vector<gu_odometry_reading> generate(const size_t count, const unsigned long long seed)
+{
+    std::mt19937_64 generator(seed);
+    std::vector<gu_odometry_reading> readings;
+    readings.reserve(count);
+    double forward = 0.0;
+    double left = 0.0;
+    double turn = 0.0;
+    uint8_t resetCounter = UINT8_MAX;
+    double forwardSpeed = 0.0;
+    double leftSpeed = 0.0;
+    double turnSpeed = 0.0;
+    size_t segmentRemaining = 0;
+    size_t resetRemaining = static_cast<size_t>(uniform(generator, 200.0, 20000.0));
+    for (size_t i = 0; i < count; i++) {
+        if (segmentRemaining == 0) {
+            segmentRemaining = static_cast<size_t>(uniform(generator, 50.0, 1000.0));
+            forwardSpeed = uniform(generator, -100.0, 300.0);
+            leftSpeed = uniform(generator, -100.0, 100.0);
+            const bool spin = uniform(generator, 0.0, 1.0) < 0.1;
+            turnSpeed = spin ? (uniform(generator, 0.0, 1.0) < 0.5 ? -6.0 : 6.0) : uniform(generator, -1.5, 1.5);
+        }
+        segmentRemaining--;
+        if (resetRemaining == 0) {
+            resetRemaining = static_cast<size_t>(uniform(generator, 200.0, 20000.0));
+            resetCounter = static_cast<uint8_t>(resetCounter + 1);
+            forward = 0.0;
+            left = 0.0;
+            turn = 0.0;
+        }
+        resetRemaining--;
+        forward += forwardSpeed * SAMPLE_PERIOD;
+        left += leftSpeed * SAMPLE_PERIOD;
+        turn += turnSpeed * SAMPLE_PERIOD;
+        const gu_odometry_reading reading = {d_to_mm_t(forward), d_to_mm_t(left), d_to_rad_d(turn), resetCounter};
+        readings.push_back(reading);
+    }
+    return readings;
+}
+
+static bool load(const char *path, std::vector<gu_odometry_reading> &readings)
+{
+    FILE *file = fopen(path, "r");
+    if (file == nullptr) {
+        return false;
+    }
+    int forward;
+    int left;
+    double turn;
+    unsigned int resetCounter;
+    while (fscanf(file, "%d,%d,%lf,%u", &forward, &left, &turn, &resetCounter) == 4) {
+        const gu_odometry_reading reading = {forward, left, turn, static_cast<uint8_t>(resetCounter)};
+        readings.push_back(reading);
+    }
+    const bool finished = feof(file) != 0;
+    fclose(file);
+    return finished;
+}
+
+static bool save(const char *path, const std::vector<gu_odometry_reading> &readings)
+{
+    FILE *file = fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < readings.size(); i++) {
+        fprintf(file, "%d,%d,%.17g,%u\n", readings[i].forward, readings[i].left, readings[i].turn, static_cast<unsigned int>(readings[i].resetCounter));
+    }
+    return fclose(file) == 0;
+}
+
+/**
+ * Integrates the same motion model as track() in long double precision
+ * without rounding the pose, giving the ground truth for the readings.
+ */
+class ReferenceIntegrator {
+
+    long double _x;
+
+    long double _y;
+
+    long double _heading;
+
+    long double _targetX;
+
+    long double _targetY;
+
+    gu_odometry_reading _lastReading;
+
+    public:
+
+    explicit ReferenceIntegrator(const gu_odometry_status initial):
+        _x(static_cast<long double>(initial.my_position.position.x)),
+        _y(static_cast<long double>(initial.my_position.position.y)),
+        _heading(static_cast<long double>(deg_t_to_rad_d(initial.my_position.heading))),
+        _targetX(0.0L),
+        _targetY(0.0L),
+        _lastReading(initial.last_reading)
+    {
+        const long double direction = _heading + static_cast<long double>(deg_d_to_rad_d(initial.target.direction));
+        const long double distance = static_cast<long double>(initial.target.distance);
+        _targetX = _x + distance * cosl(direction);
+        _targetY = _y + distance * sinl(direction);
+    }
+
+    void integrate(const gu_odometry_reading *readings, const size_t count)
+    {
+        for (size_t i = 0; i < count; i++) {
+            const gu_odometry_reading reading = readings[i];
+            const bool reset = reading.resetCounter != _lastReading.resetCounter;
+            const long double forward = static_cast<long double>(reset ? reading.forward : reading.forward - _lastReading.forward);
+            const long double left = static_cast<long double>(reset ? reading.left : reading.left - _lastReading.left);
+            const long double turn = reset ? static_cast<long double>(reading.turn) : static_cast<long double>(reading.turn) - static_cast<long double>(_lastReading.turn);
+            const long double angle = _heading + turn;
+            _x += forward * cosl(angle) - left * sinl(angle);
+            _y += forward * sinl(angle) + left * cosl(angle);
+            _heading = angle;
+            _lastReading = reading;
+        }
+    }
+
+    long double x() const { return _x; }
+
+    long double y() const { return _y; }
+
+    long double heading() const { return _heading; }
+
+    long double targetX() const { return _targetX; }
+
+    long double targetY() const { return _targetY; }
+
+};
+
+static long double wrapDegrees(const long double degrees)
+{
+    return degrees - 360.0L * floorl((degrees + 180.0L) / 360.0L);
+}
+
+struct Errors {
+    double position;
+    double heading;
+    double target;
+};
+
+/**
+ * The position error in millimetres, the heading error in degrees and the
+ * distance in millimetres between where the integrator and the reference
+ * believe the target is, relative to the robot.
+ */
+static Errors compare(const GUREPLAY::Integrator &integrator, const ReferenceIntegrator &reference)
+{
+    const gu_field_coordinate position = integrator.position();
+    const long double dx = static_cast<long double>(position.position.x) - reference.x();
+    const long double dy = static_cast<long double>(position.position.y) - reference.y();
+    const long double referenceHeading = reference.heading() * 180.0L / static_cast<long double>(M_PI);
+    const long double headingError = wrapDegrees(static_cast<long double>(position.heading) - referenceHeading);
+    const gu_relative_coordinate target = integrator.target();
+    const long double targetDirection = static_cast<long double>(deg_d_to_rad_d(target.direction));
+    const long double targetDistance = static_cast<long double>(target.distance);
+    const long double relativeX = reference.targetX() - reference.x();
+    const long double relativeY = reference.targetY() - reference.y();
+    const long double cosine = cosl(reference.heading());
+    const long double sine = sinl(reference.heading());
+    const long double referenceForward = relativeX * cosine + relativeY * sine;
+    const long double referenceLeft = -relativeX * sine + relativeY * cosine;
+    const long double targetForward = targetDistance * cosl(targetDirection) - referenceForward;
+    const long double targetLeft = targetDistance * sinl(targetDirection) - referenceLeft;
+    const Errors errors = {
+        static_cast<double>(sqrtl(dx * dx + dy * dy)),
+        static_cast<double>(fabsl(headingError)),
+        static_cast<double>(sqrtl(targetForward * targetForward + targetLeft * targetLeft))
+    };
+    return errors;
+}
+
+struct Result {
+    std::string name;
+    double readingsPerSecond;
+    Errors final;
+    Errors max;
+};
+
+static Result replay(const GUREPLAY::RegisteredIntegrator &registered, const std::vector<gu_odometry_reading> &readings, const gu_odometry_status initial, const size_t chunk)
+{
+    std::unique_ptr<GUREPLAY::Integrator> integrator(registered.factory());
+    integrator->reset(initial);
+    ReferenceIntegrator reference(initial);
+    Result result = {registered.name, 0.0, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+    for (size_t start = 0; start < readings.size(); start += chunk) {
+        const size_t count = readings.size() - start < chunk ? readings.size() - start : chunk;
+        const std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+        integrator->integrate(readings.data() + start, count);
+        elapsed += std::chrono::steady_clock::now() - before;
+        reference.integrate(readings.data() + start, count);
+        result.final = compare(*integrator, reference);
+        result.max.position = fmax(result.max.position, result.final.position);
+        result.max.heading = fmax(result.max.heading, result.final.heading);
+        result.max.target = fmax(result.max.target, result.final.target);
+    }
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    result.readingsPerSecond = seconds > 0.0 ? static_cast<double>(readings.size()) / seconds : 0.0;
+    return result;
+}
+
+static bool writeJSON(const char *path, const size_t readings, const std::vector<Result> &results)
+{
+    FILE *file = fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "{\n  \"readings\": %zu,\n  \"integrators\": [\n", readings);
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result &result = results[i];
+        fprintf(file, "    {\n");
+        fprintf(file, "      \"name\": \"%s\",\n", result.name.c_str());
+        fprintf(file, "      \"readings_per_second\": %.1f,\n", result.readingsPerSecond);
+        fprintf(file, "      \"final_position_error_mm\": %.3f,\n", result.final.position);
+        fprintf(file, "      \"max_position_error_mm\": %.3f,\n", result.max.position);
+        fprintf(file, "      \"final_heading_error_deg\": %.3f,\n", result.final.heading);
+        fprintf(file, "      \"max_heading_error_deg\": %.3f,\n", result.max.heading);
+        fprintf(file, "      \"final_target_error_mm\": %.3f,\n", result.final.target);
+        fprintf(file, "      \"max_target_error_mm\": %.3f\n", result.max.target);
+        fprintf(file, "    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    return fclose(file) == 0;
+}
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [--readings=<count>] [--seed=<seed>] [--load=<csv>] [--save=<csv>] [--chunk=<readings>] [--filter=<substring>] [--json=<file>]\n", name);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t count = 360000;
+    unsigned long long seed = 1;
+    size_t chunk = 100;
+    const char *loadPath = nullptr;
+    const char *savePath = nullptr;
+    const char *json = nullptr;
+    const char *filter = "";
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--readings=", 11) == 0) {
+            count = static_cast<size_t>(strtoull(argv[i] + 11, nullptr, 10));
+        } else if (strncmp(argv[i], "--seed=", 7) == 0) {
+            seed = strtoull(argv[i] + 7, nullptr, 10);
+        } else if (strncmp(argv[i], "--chunk=", 8) == 0) {
+            chunk = static_cast<size_t>(strtoull(argv[i] + 8, nullptr, 10));
+        } else if (strncmp(argv[i], "--load=", 7) == 0) {
+            loadPath = argv[i] + 7;
+        } else if (strncmp(argv[i], "--save=", 7) == 0) {
+            savePath = argv[i] + 7;
+        } else if (strncmp(argv[i], "--filter=", 9) == 0) {
+            filter = argv[i] + 9;
+        } else if (strncmp(argv[i], "--json=", 7) == 0) {
+            json = argv[i] + 7;
+        } else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (chunk == 0) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    std::vector<gu_odometry_reading> readings;
+    if (loadPath != nullptr) {
+        if (!load(loadPath, readings)) {
+            fprintf(stderr, "Unable to load %s\n", loadPath);
+            return EXIT_FAILURE;
+        }
+    } else {
+        readings = generate(count, seed);
+    }
+    if (savePath != nullptr && !save(savePath, readings)) {
+        fprintf(stderr, "Unable to write %s\n", savePath);
+        return EXIT_FAILURE;
+    }
+    const gu_odometry_reading initialReading = {0, 0, 0.0, 0};
+    const gu_relative_coordinate target = {35.0, 2000};
+    const gu_odometry_status initial = create_status(initialReading, target);
+    printf("Replaying %zu readings (%.1f minutes at 100Hz)\n", readings.size(), static_cast<double>(readings.size()) * SAMPLE_PERIOD / 60.0);
+    printf("%-24s %14s %12s %12s %12s %12s %12s %12s\n", "Integrator", "readings/s", "pos mm", "max pos mm", "head deg", "max head", "target mm", "max target");
+    std::vector<Result> results;
+    for (size_t i = 0; i < GUREPLAY::integrators().size(); i++) {
+        const GUREPLAY::RegisteredIntegrator &integrator = GUREPLAY::integrators()[i];
+        if (strstr(integrator.name, filter) == nullptr) {
+            continue;
+        }
+        const Result result = replay(integrator, readings, initial, chunk);
+        results.push_back(result);
+        printf("%-24s %14.0f %12.1f %12.1f %12.2f %12.2f %12.1f %12.1f\n", result.name.c_str(), result.readingsPerSecond, result.final.position, result.max.position, result.final.heading, result.max.heading, result.final.target, result.max.target);
+    }
+    if (json != nullptr && !writeJSON(json, readings.size(), results)) {
+        fprintf(stderr, "Unable to write %s\n", json);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,149 @@
+/*
+ * track_integrators.cc
+ * Copyright (C) 2026 Morgan McColl <morgan.mccoll@alumni.griffithuni.edu.au>
+ *
+ * Distributed under terms of the MIT license.
+ */
+
+#include "integrator.hpp"
+
+#include <vector>
+
+class TrackIntegrator: public GUREPLAY::Integrator {
+
+    gu_odometry_status _status;
+
+    public:
+
+    TrackIntegrator(): _status() {}
+
+    void reset(const gu_odometry_status initial) override
+    {
+        _status = initial;
+    }
+
+    void integrate(const gu_odometry_reading *readings, const size_t count) override
+    {
+        for (size_t i = 0; i < count; i++) {
+            _status = track(readings[i], _status);
+        }
+    }
+
+    gu_field_coordinate position() const override
+    {
+        return _status.my_position;
+    }
+
+    gu_relative_coordinate target() const override
+    {
+        return _status.target;
+    }
+
+};
+REPLAY_INTEGRATOR("track", TrackIntegrator);
+
+class TrackBatchIntegrator: public GUREPLAY::Integrator {
+
+    gu_odometry_status _status;
+
+    std::vector<gu_odometry_status> _out;
+
+    public:
+
+    TrackBatchIntegrator(): _status(), _out() {}
+
+    void reset(const gu_odometry_status initial) override
+    {
+        _status = initial;
+    }
+
+    void integrate(const gu_odometry_reading *readings, const size_t count) override
+    {
+        if (count == 0) {
+            return;
+        }
+        if (_out.size() < count) {
+            _out.resize(count);
+        }
+        track_batch(readings, count, _status, _out.data());
+        _status = _out[count - 1];
+    }
+
+    gu_field_coordinate position() const override
+    {
+        return _status.my_position;
+    }
+
+    gu_relative_coordinate target() const override
+    {
+        return _status.target;
+    }
+
+};
+REPLAY_INTEGRATOR("track_batch", TrackBatchIntegrator);
+
+class TrackCartesianIntegrator: public GUREPLAY::Integrator {
+
+    gu_cartesian_odometry_status _status;
+
+    public:
+
+    TrackCartesianIntegrator(): _status() {}
+
+    void reset(const gu_odometry_status initial) override
+    {
+        _status = create_cartesian_status(initial);
+    }
+
+    void integrate(const gu_odometry_reading *readings, const size_t count) override
+    {
+        for (size_t i = 0; i < count; i++) {
+            _status = track_cartesian(readings[i], _status);
+        }
+    }
+
+    gu_field_coordinate position() const override
+    {
+        return _status.my_position;
+    }
+
+    gu_relative_coordinate target() const override
+    {
+        return cartesian_status_target(_status);
+    }
+
+};
+REPLAY_INTEGRATOR("track_cartesian", TrackCartesianIntegrator);
+
+class TrackPreciseIntegrator: public GUREPLAY::Integrator {
+
+    gu_precise_odometry_status _status;
+
+    public:
+
+    TrackPreciseIntegrator(): _status() {}
+
+    void reset(const gu_odometry_status initial) override
+    {
+        _status = create_precise_status(initial);
+    }
+
+    void integrate(const gu_odometry_reading *readings, const size_t count) override
+    {
+        for (size_t i = 0; i < count; i++) {
+            _status = track_precise(readings[i], _status);
+        }
+    }
+
+    gu_field_coordinate position() const override
+    {
+        return precise_status_position(_status);
+    }
+
+    gu_relative_coordinate target() const override
+    {
+        return precise_status_target(_status);
+    }
+
+};
+REPLAY_INTEGRATOR("track_precise", TrackPreciseIntegrator);
@@ -0,0 +1,118 @@
+/*
+ * ring_index.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef GUNAVIGATION_RING_INDEX_H
+#define GUNAVIGATION_RING_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The index arithmetic shared by the fixed-capacity ring buffers
+ * gu_pose_history and gu_sighting_ring. Each ring stores its oldest
+ * element at the physical index start and holds count of its capacity
+ * elements, in order of a non-decreasing uint64_t key.
+ */
+
+/*
+ * The physical index of the index'th oldest element.
+ */
+static inline size_t gu_ring_index_physical(const size_t start, const size_t capacity, const size_t index)
+{
+    const size_t offset = start + index;
+    return offset >= capacity ? offset - capacity : offset;
+}
+
+/*
+ * The physical index at which to store a new newest element. When the ring
+ * is full the oldest element is discarded to make room. The capacity must
+ * not be zero.
+ */
+static inline size_t gu_ring_index_push(size_t *start, size_t *count, const size_t capacity)
+{
+    if (*count == capacity) {
+        const size_t index = *start;
+        *start = gu_ring_index_physical(*start, capacity, 1);
+        return index;
+    }
+    (*count)++;
+    return gu_ring_index_physical(*start, capacity, *count - 1);
+}
+
+/*
+ * The index of the oldest element whose key is not less than key, or count
+ * if there is none. key_at returns the key of the index'th oldest element
+ * of ring.
+ */
+static inline size_t gu_ring_index_lower_bound(const void *ring, const size_t count, const uint64_t key, uint64_t (*key_at)(const void *, size_t))
+{
+    size_t lower = 0;
+    size_t upper = count;
+    while (lower < upper) {
+        const size_t middle = lower + (upper - lower) / 2;
+        if (key_at(ring, middle) < key) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return lower;
+}
+
+#endif  /* GUNAVIGATION_RING_INDEX_H */
@@ -0,0 +1,122 @@
+/*
+ * sighting_ring.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "sighting_ring.h"
+#include "ring_index.h"
+
+static uint64_t frame_at(const void *ring, const size_t index)
+{
+    return gu_sighting_ring_get((const gu_sighting_ring *) ring, index)->frameNumber;
+}
+
+void gu_sighting_ring_init(gu_sighting_ring *ring, gu_sighting *buffer, const size_t capacity)
+{
+    ring->sightings = buffer;
+    ring->capacity = capacity;
+    ring->start = 0;
+    ring->count = 0;
+}
+
+void gu_sighting_ring_clear(gu_sighting_ring *ring)
+{
+    ring->start = 0;
+    ring->count = 0;
+}
+
+bool gu_sighting_ring_push(gu_sighting_ring *ring, const gu_sighting sighting)
+{
+    if (ring->capacity == 0) {
+        return false;
+    }
+    if (ring->count > 0 && sighting.frameNumber < gu_sighting_ring_get(ring, ring->count - 1)->frameNumber) {
+        return false;
+    }
+    const size_t index = gu_ring_index_push(&ring->start, &ring->count, ring->capacity);
+    ring->sightings[index] = sighting;
+    return true;
+}
+
+const gu_sighting *gu_sighting_ring_get(const gu_sighting_ring *ring, const size_t index)
+{
+    return &ring->sightings[gu_ring_index_physical(ring->start, ring->capacity, index)];
+}
+
+size_t gu_sighting_ring_frames(const gu_sighting_ring *ring, const uint64_t first, const uint64_t last, gu_sighting_span spans[2])
+{
+    if (first > last) {
+        return 0;
+    }
+    const size_t lower = gu_ring_index_lower_bound(ring, ring->count, first, frame_at);
+    const size_t upper = last == UINT64_MAX ? ring->count : gu_ring_index_lower_bound(ring, ring->count, last + 1, frame_at);
+    if (lower >= upper) {
+        return 0;
+    }
+    const size_t start = gu_ring_index_physical(ring->start, ring->capacity, lower);
+    const size_t count = upper - lower;
+    const size_t untilEnd = ring->capacity - start;
+    spans[0].sightings = &ring->sightings[start];
+    if (count <= untilEnd) {
+        spans[0].count = count;
+        return 1;
+    }
+    spans[0].count = untilEnd;
+    spans[1].sightings = ring->sightings;
+    spans[1].count = count - untilEnd;
+    return 2;
+}
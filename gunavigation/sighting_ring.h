@@ -0,0 +1,138 @@
+/*
+ * sighting_ring.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SIGHTING_RING_H
+#define SIGHTING_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sightings.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A contiguous run of sightings inside a gu_sighting_ring.
+ */
+typedef struct gu_sighting_span {
+
+    const gu_sighting *sightings;
+
+    size_t count;
+
+} gu_sighting_span;
+
+/**
+ * A fixed-capacity ring buffer of sightings ordered by frame number.
+ *
+ * The sightings are stored in a caller supplied buffer so the ring never
+ * allocates. Once the buffer is full, pushing a new sighting discards the
+ * oldest one. Frame numbers must not decrease, although any number of
+ * sightings may share a frame.
+ */
+typedef struct gu_sighting_ring {
+
+    gu_sighting *sightings;
+
+    size_t capacity;
+
+    /**
+     * The physical index of the oldest sighting.
+     */
+    size_t start;
+
+    size_t count;
+
+} gu_sighting_ring;
+
+void gu_sighting_ring_init(gu_sighting_ring *ring, gu_sighting *buffer, const size_t capacity);
+
+void gu_sighting_ring_clear(gu_sighting_ring *ring);
+
+/**
+ * Record a sighting. Returns false, leaving the ring unchanged, if the
+ * sighting's frame number is less than that of the newest sighting or if
+ * the ring has no capacity.
+ */
+bool gu_sighting_ring_push(gu_sighting_ring *ring, const gu_sighting sighting);
+
+/**
+ * Fetch the i'th oldest sighting.
+ */
+const gu_sighting *gu_sighting_ring_get(const gu_sighting_ring *ring, const size_t index) __attribute__((pure));
+
+/**
+ * Find the sightings from frames first to last inclusive in O(log n)
+ * without copying them.
+ *
+ * The sightings occupy at most two contiguous runs of the buffer, because
+ * they may wrap around its end. The runs are written to spans, oldest first,
+ * and the number of runs (0, 1 or 2) is returned. The spans are invalidated
+ * by the next push.
+ */
+size_t gu_sighting_ring_frames(const gu_sighting_ring *ring, const uint64_t first, const uint64_t last, gu_sighting_span spans[2]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* SIGHTING_RING_H */
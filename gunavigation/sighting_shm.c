@@ -0,0 +1,217 @@
+/*
+ * sighting_shm.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "sighting_shm.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static size_t mapped_size(const size_t capacity)
+{
+    return sizeof(gu_sighting_shm_header) + capacity * sizeof(gu_sighting);
+}
+
+static bool map(gu_sighting_shm *shm, const int fd, const size_t size)
+{
+    void *memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        return false;
+    }
+    shm->header = (gu_sighting_shm_header *) memory;
+    shm->sightings = (gu_sighting *) (void *) ((uint8_t *) memory + sizeof(gu_sighting_shm_header));
+    shm->mappedSize = size;
+    return true;
+}
+
+static size_t physical_index(const gu_sighting_shm *shm, const uint64_t index)
+{
+    return (size_t) (index % (uint64_t) shm->capacity);
+}
+
+bool gu_sighting_shm_create(gu_sighting_shm *shm, const char *path, const size_t capacity)
+{
+    if (capacity == 0) {
+        return false;
+    }
+    unlink(path);
+    const int fd = open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        return false;
+    }
+    const size_t size = mapped_size(capacity);
+    if (ftruncate(fd, (off_t) size) != 0) {
+        close(fd);
+        return false;
+    }
+    if (!map(shm, fd, size)) {
+        return false;
+    }
+    shm->capacity = capacity;
+    gu_sighting_shm_header *header = shm->header;
+    header->version = GU_SIGHTING_SHM_VERSION;
+    header->sightingSize = (uint32_t) sizeof(gu_sighting);
+    header->reserved = 0;
+    header->capacity = (uint64_t) capacity;
+    header->written = 0;
+    header->read = 0;
+    __atomic_store_n(&header->magic, GU_SIGHTING_SHM_MAGIC, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool gu_sighting_shm_open(gu_sighting_shm *shm, const char *path)
+{
+    const int fd = open(path, O_RDWR);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || (size_t) status.st_size < sizeof(gu_sighting_shm_header)) {
+        close(fd);
+        return false;
+    }
+    if (!map(shm, fd, (size_t) status.st_size)) {
+        return false;
+    }
+    const gu_sighting_shm_header *header = shm->header;
+    if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != GU_SIGHTING_SHM_MAGIC
+        || header->version != GU_SIGHTING_SHM_VERSION
+        || header->sightingSize != sizeof(gu_sighting)
+        || header->capacity == 0
+        || mapped_size((size_t) header->capacity) != shm->mappedSize) {
+        gu_sighting_shm_close(shm);
+        return false;
+    }
+    shm->capacity = (size_t) header->capacity;
+    return true;
+}
+
+void gu_sighting_shm_close(gu_sighting_shm *shm)
+{
+    if (shm->header != NULL) {
+        munmap((void *) shm->header, shm->mappedSize);
+    }
+    shm->header = NULL;
+    shm->sightings = NULL;
+    shm->capacity = 0;
+    shm->mappedSize = 0;
+}
+
+gu_sighting *gu_sighting_shm_reserve(const gu_sighting_shm *shm, const size_t offset)
+{
+    const uint64_t written = __atomic_load_n(&shm->header->written, __ATOMIC_RELAXED);
+    const uint64_t read = __atomic_load_n(&shm->header->read, __ATOMIC_ACQUIRE);
+    if (written - read + (uint64_t) offset >= (uint64_t) shm->capacity) {
+        return NULL;
+    }
+    return &shm->sightings[physical_index(shm, written + (uint64_t) offset)];
+}
+
+void gu_sighting_shm_commit(gu_sighting_shm *shm, const size_t count)
+{
+    const uint64_t written = __atomic_load_n(&shm->header->written, __ATOMIC_RELAXED);
+    __atomic_store_n(&shm->header->written, written + (uint64_t) count, __ATOMIC_RELEASE);
+}
+
+bool gu_sighting_shm_write(gu_sighting_shm *shm, const gu_sighting sighting)
+{
+    gu_sighting *slot = gu_sighting_shm_reserve(shm, 0);
+    if (slot == NULL) {
+        return false;
+    }
+    *slot = sighting;
+    gu_sighting_shm_commit(shm, 1);
+    return true;
+}
+
+size_t gu_sighting_shm_peek(const gu_sighting_shm *shm, gu_sighting_span spans[2])
+{
+    const uint64_t read = __atomic_load_n(&shm->header->read, __ATOMIC_RELAXED);
+    const uint64_t written = __atomic_load_n(&shm->header->written, __ATOMIC_ACQUIRE);
+    // The header is shared with another process, so never trust it to
+    // describe more sightings than the ring holds.
+    if (written - read > (uint64_t) shm->capacity) {
+        return 0;
+    }
+    const size_t count = (size_t) (written - read);
+    if (count == 0) {
+        return 0;
+    }
+    const size_t start = physical_index(shm, read);
+    const size_t untilEnd = shm->capacity - start;
+    spans[0].sightings = &shm->sightings[start];
+    if (count <= untilEnd) {
+        spans[0].count = count;
+        return 1;
+    }
+    spans[0].count = untilEnd;
+    spans[1].sightings = shm->sightings;
+    spans[1].count = count - untilEnd;
+    return 2;
+}
+
+void gu_sighting_shm_release(gu_sighting_shm *shm, const size_t count)
+{
+    const uint64_t read = __atomic_load_n(&shm->header->read, __ATOMIC_RELAXED);
+    __atomic_store_n(&shm->header->read, read + (uint64_t) count, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,208 @@
+/*
+ * sighting_shm.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SIGHTING_SHM_H
+#define SIGHTING_SHM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sightings.h"
+#include "sighting_ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Identifies a file as a sighting ring ("GUSR").
+ */
+#define GU_SIGHTING_SHM_MAGIC 0x47555352u
+
+/**
+ * The layout version of gu_sighting_shm_header. Increment whenever the
+ * header or gu_sighting changes.
+ */
+#define GU_SIGHTING_SHM_VERSION 1u
+
+#define GU_SIGHTING_SHM_CACHE_LINE 64
+
+/**
+ * The header at the start of a shared sighting ring.
+ *
+ * The writer's and reader's counters are on separate cache lines so that
+ * the two processes do not contend for the same line.
+ */
+typedef struct gu_sighting_shm_header {
+
+    /**
+     * GU_SIGHTING_SHM_MAGIC, written last once the header is initialised.
+     */
+    uint32_t magic;
+
+    uint32_t version;
+
+    /**
+     * sizeof(gu_sighting) in the writing process.
+     */
+    uint32_t sightingSize;
+
+    uint32_t reserved;
+
+    uint64_t capacity;
+
+    uint8_t padding0[GU_SIGHTING_SHM_CACHE_LINE - 24];
+
+    /**
+     * The total number of sightings committed by the writer.
+     */
+    uint64_t written;
+
+    uint8_t padding1[GU_SIGHTING_SHM_CACHE_LINE - 8];
+
+    /**
+     * The total number of sightings released by the reader.
+     */
+    uint64_t read;
+
+    uint8_t padding2[GU_SIGHTING_SHM_CACHE_LINE - 8];
+
+} gu_sighting_shm_header;
+
+/**
+ * A single producer, single consumer ring of sightings in a memory mapped
+ * file shared between two processes.
+ *
+ * The writer fills slots in place with gu_sighting_shm_reserve and makes
+ * them visible with gu_sighting_shm_commit. The reader accesses committed
+ * sightings in place with gu_sighting_shm_peek and frees their slots with
+ * gu_sighting_shm_release. Neither side copies or serialises sightings.
+ * The writer never overwrites sightings the reader has not released.
+ *
+ * On Linux the file should be placed in /dev/shm so that it is never
+ * written to disk.
+ */
+typedef struct gu_sighting_shm {
+
+    gu_sighting_shm_header *header;
+
+    gu_sighting *sightings;
+
+    size_t capacity;
+
+    size_t mappedSize;
+
+} gu_sighting_shm;
+
+/**
+ * Create the file at path, replacing any existing file, and map a ring
+ * with room for capacity sightings. Returns false on failure.
+ */
+bool gu_sighting_shm_create(gu_sighting_shm *shm, const char *path, const size_t capacity);
+
+/**
+ * Map the ring created at path by another process.
+ *
+ * Returns false if the file does not exist, has not been fully initialised
+ * yet, or was created with a different header version or gu_sighting
+ * layout.
+ */
+bool gu_sighting_shm_open(gu_sighting_shm *shm, const char *path);
+
+void gu_sighting_shm_close(gu_sighting_shm *shm);
+
+/**
+ * Returns the slot offset places after the last committed sighting, or NULL
+ * if that slot still holds a sighting the reader has not released. Only the
+ * writer may call this.
+ */
+gu_sighting *gu_sighting_shm_reserve(const gu_sighting_shm *shm, const size_t offset);
+
+/**
+ * Make the next count reserved sightings visible to the reader.
+ */
+void gu_sighting_shm_commit(gu_sighting_shm *shm, const size_t count);
+
+/**
+ * Reserve, fill and commit a single sighting. Returns false if the ring
+ * is full.
+ */
+bool gu_sighting_shm_write(gu_sighting_shm *shm, const gu_sighting sighting);
+
+/**
+ * Find the committed sightings that have not been released, in place.
+ *
+ * Like gu_sighting_ring_frames they occupy at most two runs of the ring,
+ * which are written to spans oldest first. Returns the number of runs,
+ * which is 0 if the shared header claims more sightings than the ring can
+ * hold. Only the reader may call this.
+ */
+size_t gu_sighting_shm_peek(const gu_sighting_shm *shm, gu_sighting_span spans[2]);
+
+/**
+ * Free the count oldest committed sightings for reuse by the writer.
+ */
+void gu_sighting_shm_release(gu_sighting_shm *shm, const size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* SIGHTING_SHM_H */
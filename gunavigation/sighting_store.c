@@ -0,0 +1,220 @@
+/*
+ * sighting_store.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "sighting_store.h"
+
+static millimetres_t cell_of(const millimetres_t value, const millimetres_t cellSize)
+{
+    return value >= 0 ? value / cellSize : -(-(value + 1) / cellSize) - 1;
+}
+
+/*
+ * Cells are hashed by their low 32 bits, so a cell beyond the range of
+ * millimetres_t shares a bucket with one inside it. Every entry found is
+ * checked by its distance, so this only costs a longer search.
+ */
+static size_t bucket_of(const gu_sighting_store *store, const int64_t cellX, const int64_t cellY)
+{
+    const uint32_t hash = ((uint32_t) cellX * 73856093u) ^ ((uint32_t) cellY * 19349663u);
+    return (size_t) hash & (store->bucketCount - 1);
+}
+
+static size_t bucket_head(const gu_sighting_store *store, const size_t bucket)
+{
+    const gu_sighting_store_bucket *entry = &store->buckets[bucket];
+    return entry->generation == store->generation ? entry->head : GU_SIGHTING_STORE_NONE;
+}
+
+/*
+ * Saturates rather than wrapping when the distance is too large for 64
+ * bits, which is beyond any maxDistance.
+ */
+static uint64_t squared_distance(const gu_cartesian_coordinate from, const gu_cartesian_coordinate to)
+{
+    const int64_t dx = (int64_t) to.x - (int64_t) from.x;
+    const int64_t dy = (int64_t) to.y - (int64_t) from.y;
+    const uint64_t absoluteX = (uint64_t) (dx < 0 ? -dx : dx);
+    const uint64_t absoluteY = (uint64_t) (dy < 0 ? -dy : dy);
+    const uint64_t squaredX = absoluteX * absoluteX;
+    const uint64_t squaredY = absoluteY * absoluteY;
+    return squaredX > UINT64_MAX - squaredY ? UINT64_MAX : squaredX + squaredY;
+}
+
+/*
+ * Ties go to the earliest entry so that both searches in nearest_index
+ * choose the same sighting.
+ */
+static void consider_entry(const gu_sighting_store *store, const gu_cartesian_coordinate position, const size_t index, uint64_t *best, size_t *bestIndex)
+{
+    const gu_sighting_store_entry *entry = &store->entries[index];
+    const uint64_t distance = squared_distance(position, entry->position);
+    if (!entry->claimed && (distance < *best || (distance == *best && index < *bestIndex))) {
+        *best = distance;
+        *bestIndex = index;
+    }
+}
+
+/*
+ * Searches the (2 * radius + 1)^2 cells around position, unless there are
+ * more cells than sightings, in which case checking every sighting is
+ * cheaper. The cell bounds are calculated in 64 bits so that they cannot
+ * overflow for any position or maxDistance.
+ */
+static size_t nearest_index(const gu_sighting_store *store, const gu_cartesian_coordinate position, const millimetres_u maxDistance)
+{
+    const int64_t cellSize = (int64_t) store->cellSize;
+    const int64_t radius = ((int64_t) maxDistance + cellSize - 1) / cellSize;
+    const uint64_t side = 2 * (uint64_t) radius + 1;
+    uint64_t best = (uint64_t) maxDistance * (uint64_t) maxDistance;
+    size_t bestIndex = GU_SIGHTING_STORE_NONE;
+    if (side > (uint64_t) store->count / side) {
+        size_t i;
+        for (i = 0; i < store->count; i++) {
+            consider_entry(store, position, i, &best, &bestIndex);
+        }
+        return bestIndex;
+    }
+    const int64_t centreX = (int64_t) cell_of(position.x, store->cellSize);
+    const int64_t centreY = (int64_t) cell_of(position.y, store->cellSize);
+    int64_t cellX;
+    int64_t cellY;
+    size_t index;
+    for (cellX = centreX - radius; cellX <= centreX + radius; cellX++) {
+        for (cellY = centreY - radius; cellY <= centreY + radius; cellY++) {
+            for (index = bucket_head(store, bucket_of(store, cellX, cellY)); index != GU_SIGHTING_STORE_NONE; index = store->entries[index].next) {
+                consider_entry(store, position, index, &best, &bestIndex);
+            }
+        }
+    }
+    return bestIndex;
+}
+
+bool gu_sighting_store_init(gu_sighting_store *store, gu_sighting_store_entry *entries, const size_t capacity, gu_sighting_store_bucket *buckets, const size_t bucketCount, const millimetres_t cellSize)
+{
+    if (bucketCount == 0 || (bucketCount & (bucketCount - 1)) != 0 || cellSize <= 0) {
+        return false;
+    }
+    store->entries = entries;
+    store->capacity = capacity;
+    store->count = 0;
+    store->buckets = buckets;
+    store->bucketCount = bucketCount;
+    store->cellSize = cellSize;
+    store->generation = 1;
+    size_t i;
+    for (i = 0; i < bucketCount; i++) {
+        buckets[i].generation = 0;
+        buckets[i].head = GU_SIGHTING_STORE_NONE;
+    }
+    return true;
+}
+
+void gu_sighting_store_clear(gu_sighting_store *store)
+{
+    store->count = 0;
+    store->generation++;
+    if (store->generation == 0) {
+        // The generation wrapped, so stale buckets could appear current.
+        size_t i;
+        for (i = 0; i < store->bucketCount; i++) {
+            store->buckets[i].generation = 0;
+        }
+        store->generation = 1;
+    }
+}
+
+bool gu_sighting_store_insert(gu_sighting_store *store, const gu_sighting sighting)
+{
+    if (store->count == store->capacity) {
+        return false;
+    }
+    const gu_cartesian_coordinate position = rr_coord_to_cartesian_coord(sighting.location);
+    const size_t bucket = bucket_of(store, cell_of(position.x, store->cellSize), cell_of(position.y, store->cellSize));
+    const size_t index = store->count;
+    gu_sighting_store_entry *entry = &store->entries[index];
+    entry->sighting = sighting;
+    entry->position = position;
+    entry->next = bucket_head(store, bucket);
+    entry->claimed = false;
+    store->buckets[bucket].generation = store->generation;
+    store->buckets[bucket].head = index;
+    store->count++;
+    return true;
+}
+
+const gu_sighting_store_entry *gu_sighting_store_nearest(const gu_sighting_store *store, const gu_cartesian_coordinate position, const millimetres_u maxDistance)
+{
+    const size_t index = nearest_index(store, position, maxDistance);
+    return index == GU_SIGHTING_STORE_NONE ? NULL : &store->entries[index];
+}
+
+size_t gu_sighting_store_associate(gu_sighting_store *store, const gu_cartesian_coordinate *tracks, const size_t trackCount, const millimetres_u maxDistance, size_t *assignments)
+{
+    size_t associated = 0;
+    size_t i;
+    for (i = 0; i < trackCount; i++) {
+        const size_t index = nearest_index(store, tracks[i], maxDistance);
+        assignments[i] = index;
+        if (index != GU_SIGHTING_STORE_NONE) {
+            store->entries[index].claimed = true;
+            associated++;
+        }
+    }
+    return associated;
+}
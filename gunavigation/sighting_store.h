@@ -0,0 +1,183 @@
+/*
+ * sighting_store.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef SIGHTING_STORE_H
+#define SIGHTING_STORE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <gucoordinates/gucoordinates.h>
+
+#include "sightings.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Marks the end of a bucket's chain and a track without a sighting.
+ */
+#define GU_SIGHTING_STORE_NONE ((size_t) -1)
+
+typedef struct gu_sighting_store_entry {
+
+    gu_sighting sighting;
+
+    /**
+     * The sighting's location relative to the robot in cartesian form.
+     */
+    gu_cartesian_coordinate position;
+
+    /**
+     * The index of the next entry in the same bucket.
+     */
+    size_t next;
+
+    /**
+     * Whether the entry has been associated with a track.
+     */
+    bool claimed;
+
+} gu_sighting_store_entry;
+
+typedef struct gu_sighting_store_bucket {
+
+    /**
+     * The store generation in which head was written. Buckets from older
+     * generations are empty, so clearing the store does not touch them.
+     */
+    uint32_t generation;
+
+    size_t head;
+
+} gu_sighting_store_bucket;
+
+/**
+ * The sightings of a single frame, binned into square cells of the plane
+ * around the robot.
+ *
+ * Cells are hashed into a caller supplied array of buckets and each bucket
+ * chains its entries through a caller supplied entry buffer, so the store
+ * never allocates. Clearing the store for the next frame is O(1).
+ */
+typedef struct gu_sighting_store {
+
+    gu_sighting_store_entry *entries;
+
+    size_t capacity;
+
+    size_t count;
+
+    gu_sighting_store_bucket *buckets;
+
+    /**
+     * The number of buckets, a power of two.
+     */
+    size_t bucketCount;
+
+    /**
+     * The width and height of a cell.
+     */
+    millimetres_t cellSize;
+
+    uint32_t generation;
+
+} gu_sighting_store;
+
+/**
+ * Returns false if bucketCount is not a power of two or cellSize is not
+ * positive.
+ */
+bool gu_sighting_store_init(gu_sighting_store *store, gu_sighting_store_entry *entries, const size_t capacity, gu_sighting_store_bucket *buckets, const size_t bucketCount, const millimetres_t cellSize);
+
+void gu_sighting_store_clear(gu_sighting_store *store);
+
+/**
+ * Returns false, leaving the store unchanged, if the store is full.
+ */
+bool gu_sighting_store_insert(gu_sighting_store *store, const gu_sighting sighting);
+
+/**
+ * Find the unclaimed sighting closest to position, within maxDistance.
+ *
+ * Only the cells within maxDistance of position are searched, so a query
+ * takes constant time when maxDistance is no larger than the cell size.
+ * When those cells outnumber the sightings every sighting is checked
+ * instead, so a query never takes longer than a linear search. Ties go to
+ * the sighting inserted first. Returns NULL if there is no such sighting.
+ */
+const gu_sighting_store_entry *gu_sighting_store_nearest(const gu_sighting_store *store, const gu_cartesian_coordinate position, const millimetres_u maxDistance) __attribute__((pure));
+
+/**
+ * Greedily associate each track, in order, with its nearest unclaimed
+ * sighting within maxDistance and claim that sighting.
+ *
+ * assignments[i] receives the index of the entry associated with
+ * tracks[i], or GU_SIGHTING_STORE_NONE. Returns the number of tracks that
+ * were associated.
+ */
+size_t gu_sighting_store_associate(gu_sighting_store *store, const gu_cartesian_coordinate *tracks, const size_t trackCount, const millimetres_u maxDistance, size_t *assignments);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* SIGHTING_STORE_H */
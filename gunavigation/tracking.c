@@ -57,29 +57,58 @@
  */
 
 #include "tracking.h"
+#include "trigonometry.h"
+#include "vectorisation.h"
 #include "math.h"
 #include "stdio.h"
+#include <stdbool.h>
+#include <stdint.h>
 
-gu_cartesian_coordinate calculate_difference(double forward, double left, double turn, double originalHeading)
+/**
+ * The number of readings track_batch processes per pass, sized so that its
+ * scratch arrays fit comfortably on the stack.
+ */
+#define TRACK_BATCH_CHUNK 64
+
+/*
+ * The left axis is the forward axis rotated by 90 degrees, so
+ * cos(angle + pi/2) = -sin(angle) and sin(angle + pi/2) = cos(angle)
+ * and a single sine/cosine pair is enough to rotate both components.
+ */
+static gu_cartesian_coordinate rotate_difference(const double forward, const double left, const double sine, const double cosine)
 {
-    const double halfPi = rad_d_to_d(deg_d_to_rad_d(d_to_deg_d(90.0)));
-    const millimetres_t x = d_to_mm_t(forward * cos(turn + originalHeading) + left * cos(turn + halfPi + originalHeading));
-    const millimetres_t y = d_to_mm_t(forward * sin(turn + originalHeading) + left * sin(turn + halfPi + originalHeading));
+    const millimetres_t x = d_to_mm_t(forward * cosine - left * sine);
+    const millimetres_t y = d_to_mm_t(forward * sine + left * cosine);
     const gu_cartesian_coordinate differentialCoordinate = {x, y};
     return differentialCoordinate;
 }
 
-static gu_cartesian_coordinate check_counter_and_calculate_difference(gu_odometry_reading currentReading, gu_odometry_status currentStatus)
+gu_cartesian_coordinate calculate_difference(double forward, double left, double turn, double originalHeading)
+{
+    double sine;
+    double cosine;
+    gu_sincos(turn + originalHeading, &sine, &cosine);
+    return rotate_difference(forward, left, sine, cosine);
+}
+
+gu_cartesian_coordinate calculate_difference_fast(double forward, double left, double turn, double originalHeading)
+{
+    double sine;
+    double cosine;
+    gu_sincos_fast(gu_sincos_fast_reduce(turn + originalHeading), &sine, &cosine);
+    return rotate_difference(forward, left, sine, cosine);
+}
+
+static gu_cartesian_coordinate check_counter_and_calculate_difference(const gu_odometry_reading currentReading, const gu_odometry_reading lastReading, const degrees_t heading)
 {
-    if (currentReading.resetCounter != currentStatus.last_reading.resetCounter) {
-        return calculate_difference(mm_t_to_d(currentReading.forward), mm_t_to_d(currentReading.left), rad_d_to_d(currentReading.turn), deg_d_to_rad_d(rad_d_to_d(currentStatus.my_position.heading)));
+    if (currentReading.resetCounter != lastReading.resetCounter) {
+        return calculate_difference(mm_t_to_d(currentReading.forward), mm_t_to_d(currentReading.left), rad_d_to_d(currentReading.turn), deg_d_to_rad_d(rad_d_to_d(heading)));
     }
-    const gu_odometry_reading lastReading = currentStatus.last_reading;
     return calculate_difference(
         mm_t_to_d(currentReading.forward - lastReading.forward),
         mm_t_to_d(currentReading.left - lastReading.left),
         rad_d_to_d(currentReading.turn - lastReading.turn),
-        deg_d_to_rad_d(rad_d_to_d(currentStatus.my_position.heading))
+        deg_d_to_rad_d(rad_d_to_d(heading))
     );
 }
 
@@ -91,21 +120,120 @@ static radians_d get_incremental_angle(gu_odometry_reading currentReading, gu_od
     return currentReading.turn - lastReading.turn;
 }
 
-gu_odometry_status track(const gu_odometry_reading currentReading, const gu_odometry_status currentStatus)
+static gu_field_coordinate move_position(
+    const gu_field_coordinate originalPosition,
+    const gu_cartesian_coordinate differentialCoordinate,
+    const degrees_t newHeading
+)
 {
-    const gu_field_coordinate originalPosition = currentStatus.my_position;
-    const gu_cartesian_coordinate differentialCoordinate = check_counter_and_calculate_difference(currentReading, currentStatus);
     gu_relative_coordinate differentialRelative = cartesian_coord_to_rr_coord(differentialCoordinate);
-    const radians_d incrementalAngle = get_incremental_angle(currentReading, currentStatus.last_reading);
-    const degrees_t newHeading = originalPosition.heading + rad_d_to_deg_t(incrementalAngle);
     differentialRelative.direction -= deg_t_to_deg_d(originalPosition.heading);
-    const gu_field_coordinate newCoordinate = rr_coord_to_field_coord_from_source(differentialRelative, originalPosition, newHeading);
-    const gu_cartesian_coordinate targetLocation = rr_coord_to_cartesian_coord_from_field(currentStatus.target, originalPosition);
-    const gu_relative_coordinate newTarget = field_coord_to_rr_coord_to_target(newCoordinate, targetLocation);
+    return rr_coord_to_field_coord_from_source(differentialRelative, originalPosition, newHeading);
+}
+
+static gu_field_coordinate integrate_position(const gu_odometry_reading currentReading, const gu_odometry_reading lastReading, const gu_field_coordinate originalPosition)
+{
+    const gu_cartesian_coordinate differentialCoordinate = check_counter_and_calculate_difference(currentReading, lastReading, originalPosition.heading);
+    const radians_d incrementalAngle = get_incremental_angle(currentReading, lastReading);
+    const degrees_t newHeading = originalPosition.heading + rad_d_to_deg_t(incrementalAngle);
+    return move_position(originalPosition, differentialCoordinate, newHeading);
+}
+
+gu_odometry_status track(const gu_odometry_reading currentReading, const gu_odometry_status currentStatus)
+{
+    const gu_field_coordinate originalPosition = currentStatus.my_position;
+    const gu_field_coordinate newCoordinate = integrate_position(currentReading, currentStatus.last_reading, originalPosition);
+    const gu_relative_coordinate newTarget = update_target_from_movement(originalPosition, newCoordinate, currentStatus.target);
     const gu_odometry_status newStatus = {newCoordinate, newTarget, currentReading};
     return newStatus;
 }
 
+void track_multi(const gu_odometry_reading currentReading, gu_multi_odometry_status *status)
+{
+    const gu_field_coordinate originalPosition = status->my_position;
+    const gu_field_coordinate newCoordinate = integrate_position(currentReading, status->last_reading, originalPosition);
+    update_targets_from_movement(originalPosition, newCoordinate, status->targets, status->targetCount);
+    status->my_position = newCoordinate;
+    status->last_reading = currentReading;
+}
+
+/*
+ * The largest forward or left step track_batch accepts. A step of this size
+ * rotated by any angle is still within the range of an int32_t.
+ */
+#define TRACK_BATCH_MAX_STEP 1073741824.0
+
+static double clamp_step(const double step)
+{
+    return step > TRACK_BATCH_MAX_STEP ? TRACK_BATCH_MAX_STEP : (step < -TRACK_BATCH_MAX_STEP ? -TRACK_BATCH_MAX_STEP : step);
+}
+
+static void rotate_differences_kernel(
+    const double * GU_RESTRICT forward,
+    const double * GU_RESTRICT left,
+    const double * GU_RESTRICT sine,
+    const double * GU_RESTRICT cosine,
+    int32_t * GU_RESTRICT x,
+    int32_t * GU_RESTRICT y,
+    const size_t count
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        x[i] = gu_round_to_int32(forward[i] * cosine[i] - left[i] * sine[i]);
+        y[i] = gu_round_to_int32(forward[i] * sine[i] + left[i] * cosine[i]);
+    }
+}
+
+void track_batch(const gu_odometry_reading *readings, const size_t n, const gu_odometry_status initial, gu_odometry_status *out)
+{
+    double forward[TRACK_BATCH_CHUNK];
+    double left[TRACK_BATCH_CHUNK];
+    double angle[TRACK_BATCH_CHUNK];
+    double sine[TRACK_BATCH_CHUNK];
+    double cosine[TRACK_BATCH_CHUNK];
+    int32_t x[TRACK_BATCH_CHUNK];
+    int32_t y[TRACK_BATCH_CHUNK];
+    const gu_cartesian_odometry_status start = create_cartesian_status(initial);
+    gu_field_coordinate position = start.my_position;
+    gu_odometry_reading lastReading = initial.last_reading;
+    size_t first;
+    for (first = 0; first < n; first += TRACK_BATCH_CHUNK) {
+        const size_t count = n - first < TRACK_BATCH_CHUNK ? n - first : TRACK_BATCH_CHUNK;
+        gu_odometry_status *chunk = &out[first];
+        size_t i;
+        // Pass 1: the headings only depend on the readings, so the angle of
+        // every step is known before any position is.
+        degrees_t heading = position.heading;
+        for (i = 0; i < count; i++) {
+            const gu_odometry_reading currentReading = readings[first + i];
+            const bool reset = currentReading.resetCounter != lastReading.resetCounter;
+            const radians_d turn = get_incremental_angle(currentReading, lastReading);
+            forward[i] = clamp_step(mm_t_to_d(reset ? currentReading.forward : currentReading.forward - lastReading.forward));
+            left[i] = clamp_step(mm_t_to_d(reset ? currentReading.left : currentReading.left - lastReading.left));
+            // The turn is an unbounded cumulative reading, so its difference
+            // may lie outside the domain of gu_sincos_fast.
+            angle[i] = gu_sincos_fast_reduce(rad_d_to_d(turn) + rad_d_to_d(deg_d_to_rad_d(rad_d_to_d(heading))));
+            heading += rad_d_to_deg_t(turn);
+            chunk[i].my_position.heading = heading;
+            chunk[i].last_reading = currentReading;
+            lastReading = currentReading;
+        }
+        // Pass 2: every differential is independent once its angle is known.
+        gu_sincos_fast_batch(angle, sine, cosine, count);
+        rotate_differences_kernel(forward, left, sine, cosine, x, y, count);
+        // Pass 3: a prefix sum of the differentials gives the positions, and
+        // the target is only converted back to polar for the output.
+        for (i = 0; i < count; i++) {
+            position.position.x += x[i];
+            position.position.y += y[i];
+            position.heading = chunk[i].my_position.heading;
+            chunk[i].my_position = position;
+            chunk[i].target = field_coord_to_rr_coord_to_target(position, start.target);
+        }
+    }
+}
+
 gu_odometry_status create_status(const gu_odometry_reading initialReading, const gu_relative_coordinate object)
 {
     const gu_field_coordinate originalPosition = {{0, 0}, 0};
@@ -113,6 +241,133 @@ gu_odometry_status create_status(const gu_odometry_reading initialReading, const
     return status;
 }
 
+gu_cartesian_odometry_status track_cartesian(const gu_odometry_reading currentReading, const gu_cartesian_odometry_status currentStatus)
+{
+    const gu_field_coordinate originalPosition = currentStatus.my_position;
+    const gu_cartesian_coordinate differentialCoordinate = check_counter_and_calculate_difference(currentReading, currentStatus.last_reading, originalPosition.heading);
+    const degrees_t newHeading = originalPosition.heading + rad_d_to_deg_t(get_incremental_angle(currentReading, currentStatus.last_reading));
+    const gu_field_coordinate newPosition = {
+        {originalPosition.position.x + differentialCoordinate.x, originalPosition.position.y + differentialCoordinate.y},
+        newHeading
+    };
+    const gu_cartesian_odometry_status newStatus = {newPosition, currentStatus.target, currentReading};
+    return newStatus;
+}
+
+gu_cartesian_odometry_status create_cartesian_status(const gu_odometry_status status)
+{
+    const gu_cartesian_odometry_status cartesian = {
+        status.my_position,
+        rr_coord_to_cartesian_coord_from_field(status.target, status.my_position),
+        status.last_reading
+    };
+    return cartesian;
+}
+
+gu_relative_coordinate cartesian_status_target(const gu_cartesian_odometry_status status)
+{
+    return field_coord_to_rr_coord_to_target(status.my_position, status.target);
+}
+
+gu_odometry_status cartesian_status_to_status(const gu_cartesian_odometry_status status)
+{
+    const gu_odometry_status view = {status.my_position, cartesian_status_target(status), status.last_reading};
+    return view;
+}
+
+gu_precise_odometry_status track_precise(const gu_odometry_reading currentReading, const gu_precise_odometry_status currentStatus)
+{
+    const bool reset = currentReading.resetCounter != currentStatus.last_reading.resetCounter;
+    const double forward = mm_t_to_d(reset ? currentReading.forward : currentReading.forward - currentStatus.last_reading.forward);
+    const double left = mm_t_to_d(reset ? currentReading.left : currentReading.left - currentStatus.last_reading.left);
+    const double heading = rad_d_to_d(currentStatus.heading) + rad_d_to_d(get_incremental_angle(currentReading, currentStatus.last_reading));
+    double sine;
+    double cosine;
+    gu_sincos(heading, &sine, &cosine);
+    gu_precise_odometry_status newStatus = currentStatus;
+    newStatus.x = mm_d_to_d(currentStatus.x) + forward * cosine - left * sine;
+    newStatus.y = mm_d_to_d(currentStatus.y) + forward * sine + left * cosine;
+    newStatus.heading = d_to_rad_d(heading);
+    newStatus.last_reading = currentReading;
+    return newStatus;
+}
+
+gu_precise_odometry_status create_precise_status(const gu_odometry_status status)
+{
+    const double x = mm_t_to_d(status.my_position.position.x);
+    const double y = mm_t_to_d(status.my_position.position.y);
+    const double heading = rad_d_to_d(deg_t_to_rad_d(status.my_position.heading));
+    const double direction = heading + rad_d_to_d(deg_d_to_rad_d(status.target.direction));
+    const double distance = mm_u_to_d(status.target.distance);
+    gu_precise_odometry_status precise;
+    precise.x = d_to_mm_d(x);
+    precise.y = d_to_mm_d(y);
+    precise.heading = d_to_rad_d(heading);
+    precise.targetX = d_to_mm_d(x + distance * cos(direction));
+    precise.targetY = d_to_mm_d(y + distance * sin(direction));
+    precise.last_reading = status.last_reading;
+    return precise;
+}
+
+/*
+ * Wrap an angle in degrees to [-180, 180).
+ */
+static double wrap_degrees(const double angle)
+{
+    return angle - 360.0 * floor((angle + 180.0) / 360.0);
+}
+
+gu_field_coordinate precise_status_position(const gu_precise_odometry_status status)
+{
+    const double heading = wrap_degrees(deg_d_to_d(rad_d_to_deg_d(status.heading)));
+    const gu_field_coordinate position = {
+        {d_to_mm_t(mm_d_to_d(status.x)), d_to_mm_t(mm_d_to_d(status.y))},
+        deg_d_to_deg_t(d_to_deg_d(heading))
+    };
+    return position;
+}
+
+gu_relative_coordinate precise_status_target(const gu_precise_odometry_status status)
+{
+    const double dx = mm_d_to_d(status.targetX) - mm_d_to_d(status.x);
+    const double dy = mm_d_to_d(status.targetY) - mm_d_to_d(status.y);
+    const double bearing = deg_d_to_d(rad_d_to_deg_d(d_to_rad_d(atan2(dy, dx))));
+    const double direction = wrap_degrees(bearing - deg_d_to_d(rad_d_to_deg_d(status.heading)));
+    const gu_relative_coordinate target = {d_to_deg_d(direction), d_to_mm_u(sqrt(dx * dx + dy * dy))};
+    return target;
+}
+
+gu_odometry_status precise_status_to_status(const gu_precise_odometry_status status)
+{
+    const gu_odometry_status view = {precise_status_position(status), precise_status_target(status), status.last_reading};
+    return view;
+}
+
+gu_multi_odometry_status create_multi_status(const gu_odometry_reading initialReading, const gu_relative_coordinates targets, const gu_relative_cartesian_coordinates storage, const size_t targetCount)
+{
+    const gu_field_coordinate originalPosition = {{0, 0}, 0};
+    const gu_multi_odometry_status status = {originalPosition, storage, targetCount, initialReading};
+    size_t i;
+    for (i = 0; i < targetCount; i++) {
+        const double direction = rad_d_to_d(deg_d_to_rad_d(targets.direction[i]));
+        const double distance = mm_u_to_d(targets.distance[i]);
+        storage.x[i] = d_to_mm_d(distance * cos(direction));
+        storage.y[i] = d_to_mm_d(distance * sin(direction));
+    }
+    return status;
+}
+
+void multi_status_targets(const gu_multi_odometry_status *status, const gu_relative_coordinates out)
+{
+    size_t i;
+    for (i = 0; i < status->targetCount; i++) {
+        const double x = mm_d_to_d(status->targets.x[i]);
+        const double y = mm_d_to_d(status->targets.y[i]);
+        out.direction[i] = rad_d_to_deg_d(d_to_rad_d(atan2(y, x)));
+        out.distance[i] = d_to_mm_u(sqrt(x * x + y * y));
+    }
+}
+
 gu_odometry_status create_status_for_self(const gu_odometry_reading initialReading)
 {
     const gu_relative_coordinate self = {0.0, 0};
@@ -126,3 +381,48 @@ gu_relative_coordinate update_target_from_movement(const gu_field_coordinate old
     return field_coord_to_rr_coord_to_target(newPosition, oldCoordinate);
 }
 
+static void transform_targets_kernel(
+    double * GU_RESTRICT x,
+    double * GU_RESTRICT y,
+    const size_t count,
+    const double sine,
+    const double cosine,
+    const double translationX,
+    const double translationY
+)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        const double oldX = x[i];
+        const double oldY = y[i];
+        x[i] = cosine * oldX + sine * oldY + translationX;
+        y[i] = cosine * oldY - sine * oldX + translationY;
+    }
+}
+
+/*
+ * A target at r relative to the old pose is at R(oldHeading) r + oldPosition
+ * in the field, and so at R(oldHeading - newHeading) r
+ * + R(-newHeading) (oldPosition - newPosition) relative to the new pose. The
+ * rotation and translation are found once and applied to every target.
+ */
+void update_targets_from_movement(const gu_field_coordinate oldPosition, const gu_field_coordinate newPosition, const gu_relative_cartesian_coordinates targets, const size_t count)
+{
+    double sine;
+    double cosine;
+    double headingSine;
+    double headingCosine;
+    gu_sincos(rad_d_to_d(deg_t_to_rad_d(newPosition.heading - oldPosition.heading)), &sine, &cosine);
+    gu_sincos(rad_d_to_d(deg_t_to_rad_d(newPosition.heading)), &headingSine, &headingCosine);
+    const double dx = mm_t_to_d(oldPosition.position.x - newPosition.position.x);
+    const double dy = mm_t_to_d(oldPosition.position.y - newPosition.position.y);
+    transform_targets_kernel(
+        targets.x,
+        targets.y,
+        count,
+        sine,
+        cosine,
+        headingCosine * dx + headingSine * dy,
+        headingCosine * dy - headingSine * dx
+    );
+}
@@ -59,6 +59,7 @@
 #ifndef TRACKING_H
 #define TRACKING_H
 
+#include <stddef.h>
 #include <guunits/guunits.h>
 #include <gucoordinates/gucoordinates.h>
 
@@ -86,22 +87,203 @@ typedef struct gu_odometry_status {
 
 } gu_odometry_status;
 
+/**
+ * A structure-of-arrays view over many gu_relative_coordinate values.
+ *
+ * The arrays are owned by the caller.
+ */
+typedef struct gu_relative_coordinates {
+
+    degrees_d *direction;
+
+    millimetres_u *distance;
+
+} gu_relative_coordinates;
+
+/**
+ * A structure-of-arrays view over many positions relative to the robot, with
+ * x forward and y to the left.
+ *
+ * The arrays are owned by the caller.
+ */
+typedef struct gu_relative_cartesian_coordinates {
+
+    millimetres_d *x;
+
+    millimetres_d *y;
+
+} gu_relative_cartesian_coordinates;
+
+/**
+ * The equivalent of gu_odometry_status for many targets.
+ *
+ * The robot's own position is integrated once per reading and then every
+ * target is moved by the same rigid transform. The targets are kept in
+ * cartesian coordinates relative to the robot and are only converted to
+ * gu_relative_coordinate by multi_status_targets.
+ */
+typedef struct gu_multi_odometry_status {
+    gu_field_coordinate my_position;
+
+    gu_relative_cartesian_coordinates targets;
+
+    size_t targetCount;
+
+    gu_odometry_reading last_reading;
+
+} gu_multi_odometry_status;
+
+/**
+ * The equivalent of gu_odometry_status which stores the target as a field
+ * position instead of relative to the robot.
+ *
+ * Since the target does not move in the field only the robot's pose changes
+ * when tracking, and the relative target is calculated when requested.
+ */
+typedef struct gu_cartesian_odometry_status {
+    gu_field_coordinate my_position;
+
+    gu_cartesian_coordinate target;
+
+    gu_odometry_reading last_reading;
+
+} gu_cartesian_odometry_status;
+
+/**
+ * An odometry status that keeps the robot's pose and the target's field
+ * position in double precision.
+ *
+ * track() rounds the position to whole millimetres and the heading to whole
+ * degrees on every reading, and the rounding accumulates into drift. The
+ * precise status only rounds when a gu_field_coordinate or
+ * gu_odometry_status view is requested.
+ */
+typedef struct gu_precise_odometry_status {
+    millimetres_d x;
+
+    millimetres_d y;
+
+    radians_d heading;
+
+    millimetres_d targetX;
+
+    millimetres_d targetY;
+
+    gu_odometry_reading last_reading;
+
+} gu_precise_odometry_status;
+
 /**
  * All Angles are in radians.
  */
 gu_cartesian_coordinate calculate_difference(double forward, double left, double turn, double originalHeading) __attribute__((const));
 
+/**
+ * Equivalent to calculate_difference but uses gu_sincos_fast. The rotated
+ * components differ from calculate_difference by at most
+ * (|forward| + |left|) * GU_SINCOS_FAST_MAX_ERROR before rounding to
+ * millimetres, so the result only differs when a component lies within
+ * that distance of a rounding boundary. The angle is first brought into
+ * the domain of gu_sincos_fast with gu_sincos_fast_reduce, so an angle
+ * beyond GU_SINCOS_FAST_RANGE is reduced with the C library, and an angle
+ * that is not finite is treated as no rotation.
+ */
+gu_cartesian_coordinate calculate_difference_fast(double forward, double left, double turn, double originalHeading) __attribute__((const));
+
 gu_odometry_status track(
     const gu_odometry_reading currentReading,
     const gu_odometry_status currentStatus
 ) __attribute__((const));
 
+/**
+ * Integrate a sequence of readings, equivalent to calling track_cartesian()
+ * on each reading in turn with differentials from
+ * calculate_difference_fast() and converting every result with
+ * cartesian_status_to_status().
+ *
+ * out[i] receives the status after readings[i] has been applied, starting
+ * from initial. out must have room for n statuses. Counter resets are
+ * handled identically to track(). The headings match track() exactly, while
+ * the positions avoid the polar round trip that track() makes on every
+ * reading. Steps larger than 2^30 millimetres are clamped, and the angle of
+ * each step is reduced by gu_sincos_fast_reduce, so any turn reading keeps
+ * the differentials defined.
+ */
+void track_batch(const gu_odometry_reading *readings, const size_t n, const gu_odometry_status initial, gu_odometry_status *out);
+
+/**
+ * Update a gu_multi_odometry_status in place with a new reading.
+ *
+ * The robot's position is the same as track() gives. The targets are moved
+ * in double precision, so they do not accumulate the rounding that track()
+ * adds to its target on every reading.
+ */
+void track_multi(const gu_odometry_reading currentReading, gu_multi_odometry_status *status);
+
 gu_odometry_status create_status(const gu_odometry_reading initialReading, const gu_relative_coordinate object) __attribute__((const));
 
+/**
+ * Integrate a reading into a cartesian status.
+ *
+ * The heading is accumulated in whole degrees exactly as in track(), and the
+ * step, rotated once into the field, is added to the position without the
+ * polar round trips that track() performs for the position and target.
+ */
+gu_cartesian_odometry_status track_cartesian(const gu_odometry_reading currentReading, const gu_cartesian_odometry_status currentStatus) __attribute__((const));
+
+gu_cartesian_odometry_status create_cartesian_status(const gu_odometry_status status) __attribute__((const));
+
+/**
+ * The target relative to the robot.
+ */
+gu_relative_coordinate cartesian_status_target(const gu_cartesian_odometry_status status) __attribute__((const));
+
+gu_odometry_status cartesian_status_to_status(const gu_cartesian_odometry_status status) __attribute__((const));
+
+/**
+ * Integrate a reading into a precise status using the same motion model as
+ * track(), without rounding.
+ */
+gu_precise_odometry_status track_precise(const gu_odometry_reading currentReading, const gu_precise_odometry_status currentStatus) __attribute__((const));
+
+gu_precise_odometry_status create_precise_status(const gu_odometry_status status) __attribute__((const));
+
+/**
+ * The robot's position rounded to whole millimetres, with the heading
+ * rounded to whole degrees within [-180, 180].
+ */
+gu_field_coordinate precise_status_position(const gu_precise_odometry_status status) __attribute__((const));
+
+/**
+ * The target relative to the robot, with the direction within [-180, 180).
+ */
+gu_relative_coordinate precise_status_target(const gu_precise_odometry_status status) __attribute__((const));
+
+gu_odometry_status precise_status_to_status(const gu_precise_odometry_status status) __attribute__((const));
+
+/**
+ * Create a multi status for targetCount targets, converting the targets into
+ * storage, which must have room for targetCount targets.
+ */
+gu_multi_odometry_status create_multi_status(const gu_odometry_reading initialReading, const gu_relative_coordinates targets, const gu_relative_cartesian_coordinates storage, const size_t targetCount);
+
+/**
+ * Write the targets of a multi status relative to the robot into out, which
+ * must have room for targetCount targets.
+ */
+void multi_status_targets(const gu_multi_odometry_status *status, const gu_relative_coordinates out);
+
 gu_odometry_status create_status_for_self(const gu_odometry_reading initialReading) __attribute__((const));
 
 gu_relative_coordinate update_target_from_movement(const gu_field_coordinate oldPosition, const gu_field_coordinate newPosition, const gu_relative_coordinate oldTarget) __attribute__((const));
 
+/**
+ * Move `count` targets relative to oldPosition in place so that they are
+ * relative to newPosition, the cartesian equivalent of applying
+ * update_target_from_movement to each target.
+ */
+void update_targets_from_movement(const gu_field_coordinate oldPosition, const gu_field_coordinate newPosition, const gu_relative_cartesian_coordinates targets, const size_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,119 @@
+/*
+ * trigonometry.c 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#include "trigonometry.h"
+#include "vectorisation.h"
+#include "math.h"
+
+#include <stdint.h>
+
+#define TWO_OVER_PI 0.63661977236758134308
+/*
+ * pi/2 split so that k * PI_OVER_2_HIGH is exact for the supported range of k.
+ */
+#define PI_OVER_2_HIGH 1.57079632673412561417
+#define PI_OVER_2_LOW 6.07710050650619224932e-11
+
+void gu_sincos(const double angle, double *sine, double *cosine)
+{
+    *sine = sin(angle);
+    *cosine = cos(angle);
+}
+
+void gu_sincos_fast(const double angle, double *sine, double *cosine)
+{
+    // A 32 bit quadrant covers GU_SINCOS_FAST_RANGE.
+    const double k = gu_round_integral(angle * TWO_OVER_PI);
+    const int32_t quadrant = (int32_t) k;
+    const double x = (angle - k * PI_OVER_2_HIGH) - k * PI_OVER_2_LOW;
+    const double x2 = x * x;
+    const double s = x * (1.0 + x2 * (-1.0 / 6.0 + x2 * (1.0 / 120.0 + x2 * (-1.0 / 5040.0 + x2 * (1.0 / 362880.0)))));
+    const double c = 1.0 + x2 * (-1.0 / 2.0 + x2 * (1.0 / 24.0 + x2 * (-1.0 / 720.0 + x2 * (1.0 / 40320.0 + x2 * (-1.0 / 3628800.0)))));
+    // Rotate the reduced result back into the original quadrant. The swap is
+    // a blend rather than a conditional, which gcc only if-converts under
+    // -fno-trapping-math; it adds at most one rounding to the swapped values.
+    const double swap = (double) (quadrant & 1);
+    const double sineSign = (double) (1 - (quadrant & 2));
+    const double cosineSign = (double) (1 - ((quadrant + 1) & 2));
+    *sine = sineSign * (s + swap * (c - s));
+    *cosine = cosineSign * (c + swap * (s - c));
+}
+
+double gu_sincos_fast_reduce(const double angle)
+{
+    if (fabs(angle) <= GU_SINCOS_FAST_RANGE) {
+        return angle;
+    }
+    // The C library reduces exactly however large the angle is, which a
+    // remainder by a rounded 2 pi does not.
+    return isfinite(angle) ? atan2(sin(angle), cos(angle)) : 0.0;
+}
+
+static void sincos_fast_kernel(const double * GU_RESTRICT angles, double * GU_RESTRICT sines, double * GU_RESTRICT cosines, const size_t count)
+{
+    size_t i;
+    for (i = 0; i < count; i++) {
+        gu_sincos_fast(angles[i], &sines[i], &cosines[i]);
+    }
+}
+
+void gu_sincos_fast_batch(const double *angles, double *sines, double *cosines, const size_t count)
+{
+    sincos_fast_kernel(angles, sines, cosines, count);
+}
@@ -0,0 +1,142 @@
+/*
+ * trigonometry.h 
+ * gunavigation 
+ *
+ * Created by Morgan McColl on 17/10/2026.
+ * Copyright © 2026 Morgan McColl. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials
+ *    provided with the distribution.
+ *
+ * 3. All advertising materials mentioning features or use of this
+ *    software must display the following acknowledgement:
+ *
+ *        This product includes software developed by Morgan McColl.
+ *
+ * 4. Neither the name of the author nor the names of contributors
+ *    may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * -----------------------------------------------------------------------
+ * This program is free software; you can redistribute it and/or
+ * modify it under the above terms or under the terms of the GNU
+ * General Public License as published by the Free Software Foundation;
+ * either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, see http://www.gnu.org/licenses/
+ * or write to the Free Software Foundation, Inc., 51 Franklin Street,
+ * Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+
+#ifndef TRIGONOMETRY_H
+#define TRIGONOMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The maximum absolute error of gu_sincos_fast for angles within
+ * [-GU_SINCOS_FAST_RANGE, GU_SINCOS_FAST_RANGE] radians.
+ */
+#define GU_SINCOS_FAST_MAX_ERROR 5.0e-9
+#define GU_SINCOS_FAST_RANGE 1.0e5
+
+/**
+ * Round to the nearest integral value, with halves to even, for values
+ * within 2^51 of zero. Adding and subtracting 1.5 * 2^52 uses plain
+ * additions, which vectorise on every target without needing floor or
+ * -fno-trapping-math.
+ */
+static inline double gu_round_integral(const double value)
+{
+    return (value + 6755399441055744.0) - 6755399441055744.0;
+}
+
+/**
+ * Round to the nearest integer with halves away from zero, as d_to_mm_t
+ * does, for values within the range of an int32_t. The fraction left by a
+ * truncating conversion is within (-1, 1), so truncating twice the fraction
+ * gives the adjustment exactly, without round() or comparisons, neither of
+ * which vectorise on every target.
+ */
+static inline int32_t gu_round_to_int32(const double value)
+{
+    const int32_t truncated = (int32_t) value;
+    const double fraction = value - (double) truncated;
+    return truncated + (int32_t) (fraction + fraction);
+}
+
+/**
+ * Calculate the sine and cosine of an angle in radians using the C library.
+ */
+void gu_sincos(const double angle, double *sine, double *cosine);
+
+/**
+ * Calculate the sine and cosine of an angle in radians with a polynomial
+ * approximation.
+ *
+ * The angle is reduced to [-pi/4, pi/4] around the nearest multiple of pi/2
+ * and evaluated with degree 9 (sine) and degree 10 (cosine) polynomials, so
+ * the truncation error is below 2e-9. The reduction uses a two part pi/2,
+ * keeping the total error below GU_SINCOS_FAST_MAX_ERROR for angles within
+ * GU_SINCOS_FAST_RANGE radians of zero. The function has no branches or
+ * library calls so that loops calling it may be vectorised.
+ */
+void gu_sincos_fast(const double angle, double *sine, double *cosine);
+
+/**
+ * Bring an angle in radians into the domain of gu_sincos_fast.
+ *
+ * gu_sincos_fast is only accurate within GU_SINCOS_FAST_RANGE and is
+ * undefined for angles that are not finite or beyond about 3e9 radians.
+ * Angles within the range are returned unchanged. Larger angles are
+ * reduced to [-pi, pi] with the C library, and angles that are not finite
+ * become zero.
+ */
+double gu_sincos_fast_reduce(const double angle) __attribute__((const));
+
+/**
+ * Apply gu_sincos_fast to count angles. The loop is vectorised, so this is
+ * much faster than calling gu_sincos_fast from another translation unit.
+ * None of the arrays may overlap.
+ */
+void gu_sincos_fast_batch(const double *angles, double *sines, double *cosines, const size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TRIGONOMETRY_H */